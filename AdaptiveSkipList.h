@@ -0,0 +1,457 @@
+/*
+    Copyright (C) 2024-2025 Cartesian Theatre. All rights reserved.
+*/
+
+// Multiple include protection...
+#ifndef _ADAPTIVE_SKIP_LIST_H_
+#define _ADAPTIVE_SKIP_LIST_H_
+
+// Includes...
+
+    // Standard C++ / POSIX system headers...
+    #include <algorithm>
+    #include <cassert>
+    #include <cstddef>
+    #include <functional>
+    #include <iterator>
+    #include <memory>
+    #include <new>
+    #include <type_traits>
+    #include <utility>
+
+    // Our headers...
+    #include "SkipList.h"
+    #include "UnrolledSkipList.h"
+
+// Adaptive skip list for collections that are usually small. Until it holds
+//  more than the given number of keys, it keeps them in a sorted array inline
+//  within itself, with their values in a separate array, so a small list
+//  allocates nothing and a search is a scan of contiguous keys, vectorised
+//  where the key type allows, instead of a chase through towers of pointers.
+//  Inserting one key more promotes it to an ordinary skip list, which is only
+//  constructed then, so small lists never pay for its header, allocator, or
+//  level generator. Once promoted it stays a skip list until cleared, so a
+//  size hovering around the threshold doesn't move keys back and forth. Keys
+//  and values must be nothrow movable, since inserting and deleting shift
+//  them within the array...
+template
+<
+    typename    KeyType,                                                        /* Key type */
+    typename    ValueType,                                                      /* Value type associated with key */
+    typename    LessThanComparisonType = decltype(std::less<KeyType>()),        /* How to compare keys to each other */
+    std::size_t InlineCapacity = 64,                                            /* Most keys held inline before promoting */
+    int         MaximumLevels = 16,                                             /* Maximum number of levels once promoted */
+    typename    AllocatorType = SkipListPoolAllocator<MaximumLevels>,           /* Node allocator once promoted */
+    typename    TraitsType = SkipListDefaultTraits                              /* Features of the skip list once promoted */
+>
+class AdaptiveSkipList
+{
+    // Check invariants...
+    static_assert(std::is_nothrow_move_constructible_v<KeyType> &&
+                  std::is_nothrow_move_assignable_v<KeyType> &&
+                  std::is_nothrow_move_constructible_v<ValueType> &&
+                  std::is_nothrow_move_assignable_v<ValueType>,
+                  "Keys and values must be nothrow movable to be shifted within the inline array.");
+    static_assert(InlineCapacity > 0, "The inline array must hold at least one key.");
+    static_assert(!TraitsType::DuplicateKeys, "An adaptive skip list can't allow duplicate keys.");
+
+    // Public types...
+    public:
+
+        // Skip list the keys are held in once promoted...
+        using ListType = SkipList<
+            KeyType, ValueType, LessThanComparisonType, MaximumLevels, AllocatorType, TraitsType>;
+
+        // Keys and values are stored apart while inline, so dereferencing an
+        //  iterator yields a pair of references to them rather than a
+        //  reference to a pair...
+        using ReferenceType     = std::pair<const KeyType &, ValueType &>;
+
+        // Type alias for how we count elements...
+        using size_type         = std::size_t;
+
+        // Custom iterator that iterates across the inline array, or the skip
+        //  list once promoted. Like the list's own, it is invalidated by
+        //  erasing the key it refers to. Unlike them, while the list is
+        //  inline, every insertion or deletion invalidates it...
+        class IteratorType
+        {
+            // Public traits...
+            public:
+
+                // Signed integer that can be used to identify distance
+                //  between iterators...
+                using difference_type   = std::ptrdiff_t;
+
+                // Category iterator belongs to...
+                using iterator_category = std::forward_iterator_tag;
+
+                // Type of object when iterator is dereferenced...
+                using value_type        = std::pair<KeyType, ValueType>;
+
+                // Type of reference to the type iterated over...
+                using reference         = ReferenceType;
+
+                // Access operator's result, which holds the pair of
+                //  references it points to...
+                using pointer           = SkipListReferencePointer<ReferenceType>;
+
+            // Public methods...
+            public:
+
+                // Default constructor...
+                IteratorType() noexcept
+                  : m_Keys(nullptr),
+                    m_Values(nullptr),
+                    m_Index(0)
+                {
+                }
+
+                // Construct pointing to the given index within the given
+                //  inline arrays, or the end if it's their count...
+                IteratorType(KeyType * const Keys, ValueType * const Values, const size_type Index) noexcept
+                  : m_Keys(Keys),
+                    m_Values(Values),
+                    m_Index(Index)
+                {
+                }
+
+                // Construct pointing to the given key value pair in the skip
+                //  list...
+                explicit IteratorType(const typename ListType::iterator ListIterator) noexcept
+                  : m_Keys(nullptr),
+                    m_Values(nullptr),
+                    m_Index(0),
+                    m_ListIterator(ListIterator)
+                {
+                }
+
+                // Dereference operator returns references to the current key
+                //  and its value. The key is const because the user modifying
+                //  it could change the sort order...
+                reference operator*() const noexcept
+                {
+                    if(m_Keys)
+                        return {m_Keys[m_Index], m_Values[m_Index]};
+                    auto &KeyValue = *m_ListIterator;
+                    return {KeyValue.first, KeyValue.second};
+                }
+
+                // Access operator...
+                pointer operator->() const noexcept { return pointer(**this); }
+
+                // Prefix increment operator...
+                IteratorType &operator++() noexcept
+                {
+                    // Seek to the next key in the array, or the list...
+                    if(m_Keys)
+                      ++m_Index;
+                    else
+                      ++m_ListIterator;
+
+                    // Return reference to updated iterator...
+                    return *this;
+                }
+
+                // Postfix increment operator...
+                IteratorType operator++(int) noexcept
+                {
+                    // Return previous state, incrementing our self...
+                    return std::exchange(*this, ++IteratorType(*this));
+                }
+
+                // Inequality operator...
+                bool operator!=(const IteratorType &RightHandSide) const noexcept
+                {
+                    return !(*this == RightHandSide);
+                }
+
+                // Equality operator. The iterators are equal if they refer to
+                //  the same index in the same array, or the same node...
+                bool operator==(const IteratorType &RightHandSide) const noexcept
+                {
+                    return (m_Keys == RightHandSide.m_Keys) &&
+                           (m_Index == RightHandSide.m_Index) &&
+                           (m_ListIterator == RightHandSide.m_ListIterator);
+                }
+
+            // Protected attributes...
+            protected:
+
+                // Inline arrays of keys and values, or null once promoted...
+                KeyType                        *m_Keys;
+                ValueType                      *m_Values;
+
+                // Index of the current key within the inline arrays...
+                size_type                       m_Index;
+
+                // Current key value pair in the skip list once promoted...
+                typename ListType::iterator     m_ListIterator;
+        };
+
+        // Type alias for iterator...
+        using iterator          = IteratorType;
+
+        // Type alias for const iterator...
+        using const_iterator    = iterator;
+
+    // Public methods...
+    public:
+
+        // Constructor...
+        explicit AdaptiveSkipList(
+            const LessThanComparisonType &LessThanCompare = LessThanComparisonType())
+          : m_LessThanComparison(LessThanCompare),
+            m_Size(0)
+        {
+        }
+
+        // Like the skip list, keys are owned by exactly one list...
+        AdaptiveSkipList(const AdaptiveSkipList &) = delete;
+        AdaptiveSkipList &operator=(const AdaptiveSkipList &) = delete;
+
+        // Retrieve an iterator start...
+        iterator begin() const noexcept
+        {
+            return m_List ? iterator(m_List->begin()) : iterator(GetKeys(), GetValues(), 0);
+        }
+        const_iterator cbegin() const noexcept { return begin(); }
+
+        // Retrieve an iterator end...
+        iterator end() const noexcept
+        {
+            return m_List ? iterator(m_List->end()) : iterator(GetKeys(), GetValues(), m_Size);
+        }
+        const_iterator cend() const noexcept { return end(); }
+
+        // Clear all elements, returning to the inline array if promoted...
+        void Clear() noexcept
+        {
+            m_List.reset();
+            DestroyInline();
+        }
+
+        // Delete the given key and its associated value if the key exists.
+        //  Return number of deleted elements, which should be either zero or
+        //  one...
+        size_type Delete(const KeyType &Key) noexcept
+        {
+            // Promoted, so the skip list deletes it...
+            if(m_List)
+                return m_List->Delete(Key);
+
+            // The key doesn't exist...
+            const size_type Index = FindIndex(Key);
+            if(Index == m_Size || IsLessThan(Key, GetKeys()[Index]))
+                return 0;
+
+            // Shift those after it down over it...
+            KeyValueArraysType::EraseAt(GetKeys(), GetValues(), m_Size, Index);
+          --m_Size;
+
+            // Signal to user deletion of a single element...
+            return 1;
+        }
+
+        // Get the number of elements...
+        size_type GetSize() const noexcept
+        {
+            return m_List ? m_List->GetSize() : m_Size;
+        }
+
+        // Insert the given key and value if it does not exist, or update its
+        //  value if it does. While inline, keys are shifted within the array
+        //  to make room, and a key that doesn't fit promotes the list first...
+        void Insert(KeyType Key, ValueType Value)
+        {
+            // Promoted, so the skip list inserts it...
+            if(m_List)
+            {
+                m_List->Insert(std::move(Key), std::move(Value));
+                return;
+            }
+
+            // The array has the given key, so update its value and we're
+            //  done...
+            KeyType * const Keys = GetKeys();
+            ValueType * const Values = GetValues();
+            const size_type Index = FindIndex(Key);
+            if(Index < m_Size && !IsLessThan(Key, Keys[Index]))
+            {
+                Values[Index] = std::move(Value);
+                return;
+            }
+
+            // The array is full, so promote to a skip list and insert it
+            //  there...
+            if(m_Size == InlineCapacity)
+            {
+                Promote();
+                m_List->Insert(std::move(Key), std::move(Value));
+                return;
+            }
+
+            // Otherwise shift those after it up to make room...
+            KeyValueArraysType::InsertAt(Keys, Values, m_Size, Index, std::move(Key), std::move(Value));
+          ++m_Size;
+        }
+
+        // Check whether the keys have outgrown the inline array and are held
+        //  in a skip list instead...
+        bool IsPromoted() const noexcept { return static_cast<bool>(m_List); }
+
+        // Find the first key value pair whose key is not less than the given
+        //  key, returning the end if there isn't one...
+        iterator LowerBound(const KeyType &Key) const
+        {
+            return m_List
+                ? iterator(m_List->LowerBound(Key))
+                : iterator(GetKeys(), GetValues(), FindIndex(Key));
+        }
+
+        // Visit every key value pair whose key is not less than the lower key
+        //  and less than the upper key, in order. The visitor is called with a
+        //  pair of references to each key and value, and if it returns a
+        //  boolean, visiting stops when it returns false. Return the number
+        //  visited...
+        template <typename VisitorType>
+        size_type Range(
+            const KeyType &LowerKey,
+            const KeyType &UpperKey,
+            VisitorType &&Visitor) const
+        {
+            size_type Visited = 0;
+            for(iterator Current = LowerBound(LowerKey);
+                (Current != end()) && IsLessThan(Current->first, UpperKey); ++Current)
+            {
+              ++Visited;
+                if(!SkipListVisit(Visitor, *Current))
+                    break;
+            }
+            return Visited;
+        }
+
+        // Search for the given key, returning an iterator to its key value pair
+        //  if found, or the end if not...
+        iterator Search(const KeyType &SearchKey) const
+        {
+            // Promoted, so the skip list searches for it...
+            if(m_List)
+                return iterator(m_List->Search(SearchKey));
+
+            // Otherwise it's at its lower bound in the array, if anywhere...
+            const size_type Index = FindIndex(SearchKey);
+            return (Index < m_Size && !IsLessThan(SearchKey, GetKeys()[Index]))
+                ? iterator(GetKeys(), GetValues(), Index) : end();
+        }
+
+        // Destructor...
+       ~AdaptiveSkipList()
+        {
+            // Release the keys and values held inline, if any...
+            DestroyInline();
+        }
+
+    // Protected types...
+    protected:
+
+        // How the sorted inline array of keys is searched...
+        using KeySearchType = SkipListKeySearch<KeyType, LessThanComparisonType>;
+
+        // How keys and values are shifted within the inline array...
+        using KeyValueArraysType = SkipListKeyValueArrays<KeyType, ValueType>;
+
+    // Protected methods...
+    protected:
+
+        // Destroy every key and value held inline...
+        void DestroyInline() noexcept
+        {
+            std::destroy_n(GetKeys(), m_Size);
+            std::destroy_n(GetValues(), m_Size);
+            m_Size = 0;
+        }
+
+        // Find the index of the first inline key not less than the given
+        //  one...
+        size_type FindIndex(const KeyType &Key) const
+        {
+            return KeySearchType::template CountBefore<false>(
+                GetKeys(), m_Size, Key, m_LessThanComparison);
+        }
+
+        // Get the start of the inline sorted array of keys...
+        KeyType *GetKeys() const noexcept
+        {
+            return std::launder(reinterpret_cast<KeyType *>(
+                const_cast<std::byte *>(m_KeyStorage)));
+        }
+
+        // Get the start of the inline array of values...
+        ValueType *GetValues() const noexcept
+        {
+            return std::launder(reinterpret_cast<ValueType *>(
+                const_cast<std::byte *>(m_ValueStorage)));
+        }
+
+        // Check if the left hand side key is less than the right hand side...
+        bool IsLessThan(const KeyType &LeftHandSide, const KeyType &RightHandSide) const
+        {
+            return m_LessThanComparison(LeftHandSide, RightHandSide);
+        }
+
+        // Move the inline keys and values into a new skip list, appending each
+        //  after the last so that none is searched for. Where they can be,
+        //  they're copied instead, so that if building the list throws, the
+        //  array is left as it was. Otherwise those moved so far are lost...
+        void Promote()
+        {
+            // Build the skip list...
+            auto List = std::make_unique<ListType>(m_LessThanComparison);
+            KeyType * const Keys = GetKeys();
+            ValueType * const Values = GetValues();
+            for(size_type Index = 0; Index < m_Size; ++Index)
+            {
+                if constexpr(std::is_copy_constructible_v<KeyType> &&
+                             std::is_copy_constructible_v<ValueType>)
+                    List->Insert(List->end(), Keys[Index], Values[Index]);
+                else
+                {
+                    try
+                    {
+                        List->Insert(List->end(), std::move(Keys[Index]), std::move(Values[Index]));
+                    }
+                    catch(...)
+                    {
+                        DestroyInline();
+                        throw;
+                    }
+                }
+            }
+
+            // Take it over, releasing the array...
+            DestroyInline();
+            m_List = std::move(List);
+        }
+
+    // Protected attributes...
+    protected:
+
+        // Storage for the sorted keys while inline, the first m_Size of which
+        //  are constructed. It comes first so scans read only keys...
+        alignas(KeyType) std::byte      m_KeyStorage[InlineCapacity * sizeof(KeyType)];
+
+        // Storage for their values, index for index...
+        alignas(ValueType) std::byte    m_ValueStorage[InlineCapacity * sizeof(ValueType)];
+
+        // Skip list holding every key once promoted, or null while inline...
+        std::unique_ptr<ListType>       m_List;
+
+        // Comparison object...
+        LessThanComparisonType          m_LessThanComparison;
+
+        // Number of keys held inline...
+        size_type                       m_Size;
+};
+
+#endif
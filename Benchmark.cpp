@@ -0,0 +1,986 @@
+// Includes...
+
+    // System...
+    #include <algorithm>
+    #include <atomic>
+    #include <chrono>
+    #include <cstdint>
+    #include <cstdlib>
+    #include <cstring>
+    #include <functional>
+    #include <iomanip>
+    #include <iostream>
+    #include <map>
+    #include <mutex>
+    #include <new>
+    #include <numeric>
+    #include <optional>
+    #include <random>
+    #include <set>
+    #include <string>
+    #include <thread>
+    #include <type_traits>
+    #include <utility>
+    #include <vector>
+
+    // Linux performance counters for cache misses, if available...
+    #if defined(__linux__)
+        #include <linux/perf_event.h>
+        #include <sys/ioctl.h>
+        #include <sys/syscall.h>
+        #include <unistd.h>
+    #endif
+
+    // Abseil's B-tree as an additional baseline, if available...
+    #if __has_include(<absl/container/btree_map.h>)
+        #include <absl/container/btree_map.h>
+        #define SKIP_LIST_BENCHMARK_ABSEIL 1
+    #endif
+
+    // Our headers...
+    #include "AdaptiveSkipList.h"
+    #include "ConcurrentSkipList.h"
+    #include "SkipList.h"
+    #include "UnrolledSkipList.h"
+
+// Use the standard namespace...
+using namespace std;
+
+// Live heap bytes, tracked by the replacement global allocation functions
+//  below so that we can measure each container's bytes per entry. Atomic
+//  since the scaling benchmarks allocate from several threads at once...
+static atomic<size_t> g_LiveBytes(0);
+
+// Keep the optimizer from inlining a function, so that it can't see through
+//  the allocation hooks below into the containers that call them...
+#if defined(__GNUC__) || defined(__clang__)
+    #define BENCHMARK_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+    #define BENCHMARK_NOINLINE __declspec(noinline)
+#else
+    #define BENCHMARK_NOINLINE
+#endif
+
+// Every allocation is prefixed with a header holding its size, so that it
+//  can be subtracted again when it's released, and how far the storage lies
+//  past the start of the underlying allocation. The prefix is at least as
+//  large as the alignment requested...
+struct AllocationHeader
+{
+    size_t  m_Bytes;
+    size_t  m_Offset;
+};
+static_assert(sizeof(AllocationHeader) <= alignof(max_align_t),
+              "The allocation header must fit within the default alignment.");
+
+// Allocate and count storage of the given size and alignment, returning null
+//  on failure...
+BENCHMARK_NOINLINE static void *AllocateCounted(const size_t Bytes, const size_t Alignment) noexcept
+{
+    // Allocate the prefix along with the requested storage, rounded up to a
+    //  multiple of the alignment for aligned_alloc()...
+    const size_t Prefix = max(Alignment, alignof(max_align_t));
+    void * const Allocation = (Prefix == alignof(max_align_t))
+        ? malloc(Prefix + Bytes)
+        : aligned_alloc(Prefix, ((Prefix + Bytes + Prefix - 1) / Prefix) * Prefix);
+    if(!Allocation)
+        return nullptr;
+
+    // Remember the size and offset just before the storage, and count it...
+    char * const Storage = static_cast<char *>(Allocation) + Prefix;
+    new(Storage - sizeof(AllocationHeader)) AllocationHeader{Bytes, Prefix};
+    g_LiveBytes.fetch_add(Bytes, memory_order_relaxed);
+
+    // Return the storage after the prefix...
+    return Storage;
+}
+
+// Uncount and release storage returned by AllocateCounted()...
+BENCHMARK_NOINLINE static void ReleaseCounted(void * const Storage) noexcept
+{
+    // Nothing to do for null...
+    if(!Storage)
+        return;
+
+    // Find the header, uncount its size, and release the allocation...
+    char * const Bytes = static_cast<char *>(Storage);
+    AllocationHeader Header;
+    memcpy(&Header, Bytes - sizeof(AllocationHeader), sizeof(Header));
+    g_LiveBytes.fetch_sub(Header.m_Bytes, memory_order_relaxed);
+    free(Bytes - Header.m_Offset);
+}
+
+// Replacement global allocation functions, ordinary and aligned, for single
+//  objects and arrays...
+BENCHMARK_NOINLINE void *operator new(const size_t Bytes)
+{
+    if(void * const Storage = AllocateCounted(Bytes, alignof(max_align_t)))
+        return Storage;
+    throw bad_alloc();
+}
+BENCHMARK_NOINLINE void *operator new[](const size_t Bytes)
+{
+    return operator new(Bytes);
+}
+BENCHMARK_NOINLINE void *operator new(const size_t Bytes, const align_val_t Alignment)
+{
+    if(void * const Storage = AllocateCounted(Bytes, static_cast<size_t>(Alignment)))
+        return Storage;
+    throw bad_alloc();
+}
+BENCHMARK_NOINLINE void *operator new[](const size_t Bytes, const align_val_t Alignment)
+{
+    return operator new(Bytes, Alignment);
+}
+
+// Replacement global de-allocation functions, matching each of the above,
+//  sized or not...
+BENCHMARK_NOINLINE void operator delete(void * const Storage) noexcept { ReleaseCounted(Storage); }
+BENCHMARK_NOINLINE void operator delete[](void * const Storage) noexcept { ReleaseCounted(Storage); }
+BENCHMARK_NOINLINE void operator delete(void * const Storage, size_t) noexcept { ReleaseCounted(Storage); }
+BENCHMARK_NOINLINE void operator delete[](void * const Storage, size_t) noexcept { ReleaseCounted(Storage); }
+BENCHMARK_NOINLINE void operator delete(void * const Storage, align_val_t) noexcept { ReleaseCounted(Storage); }
+BENCHMARK_NOINLINE void operator delete[](void * const Storage, align_val_t) noexcept { ReleaseCounted(Storage); }
+BENCHMARK_NOINLINE void operator delete(void * const Storage, size_t, align_val_t) noexcept { ReleaseCounted(Storage); }
+BENCHMARK_NOINLINE void operator delete[](void * const Storage, size_t, align_val_t) noexcept { ReleaseCounted(Storage); }
+
+// Keep the optimizer from discarding a computed value...
+template <typename Type>
+static void DoNotOptimize(const Type &Value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(Value) : "memory");
+#else
+    static volatile const Type *Sink;
+    Sink = &Value;
+#endif
+}
+
+// Counts last level cache misses incurred by this thread, and any threads it
+//  starts, between Start() and Stop(), when the platform lets us...
+class CacheMissCounter
+{
+    // Public methods...
+    public:
+
+        // Constructor opens the counter, if possible...
+        CacheMissCounter()
+          : m_Descriptor(-1)
+        {
+        #if defined(__linux__)
+            perf_event_attr Attributes;
+            memset(&Attributes, 0, sizeof(Attributes));
+            Attributes.type             = PERF_TYPE_HARDWARE;
+            Attributes.size             = sizeof(Attributes);
+            Attributes.config           = PERF_COUNT_HW_CACHE_MISSES;
+            Attributes.disabled         = 1;
+            Attributes.exclude_kernel   = 1;
+            Attributes.exclude_hv       = 1;
+            Attributes.inherit          = 1;
+            m_Descriptor = static_cast<int>(
+                syscall(__NR_perf_event_open, &Attributes, 0, -1, -1, 0));
+        #endif
+        }
+
+        // Counters are owned by exactly one object...
+        CacheMissCounter(const CacheMissCounter &) = delete;
+        CacheMissCounter &operator=(const CacheMissCounter &) = delete;
+
+        // Reset and begin counting...
+        void Start() noexcept
+        {
+        #if defined(__linux__)
+            if(m_Descriptor >= 0)
+            {
+                ioctl(m_Descriptor, PERF_EVENT_IOC_RESET, 0);
+                ioctl(m_Descriptor, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        #endif
+        }
+
+        // Stop counting, returning the number of misses since Start(), if
+        //  known...
+        optional<uint64_t> Stop() noexcept
+        {
+        #if defined(__linux__)
+            uint64_t Count = 0;
+            if(m_Descriptor >= 0)
+            {
+                ioctl(m_Descriptor, PERF_EVENT_IOC_DISABLE, 0);
+                if(read(m_Descriptor, &Count, sizeof(Count)) == sizeof(Count))
+                    return Count;
+            }
+        #endif
+            return nullopt;
+        }
+
+        // Destructor closes the counter...
+       ~CacheMissCounter()
+        {
+        #if defined(__linux__)
+            if(m_Descriptor >= 0)
+                close(m_Descriptor);
+        #endif
+        }
+
+    // Protected attributes...
+    protected:
+
+        // File descriptor for the counter, or negative if unavailable...
+        int     m_Descriptor;
+};
+
+// Command line options...
+struct OptionsType
+{
+    // Largest container size to benchmark...
+    size_t  m_MaximumSize = 1000000;
+
+    // Only run benchmarks whose names contain this...
+    string  m_Filter;
+
+    // Most threads to run the scaling benchmarks with...
+    unsigned m_MaximumThreads = max(thread::hardware_concurrency(), 1u);
+};
+
+// Global state for running and reporting benchmarks...
+static OptionsType          g_Options;
+static CacheMissCounter     g_CacheMisses;
+
+// Check whether the benchmark with the given name should run...
+static bool IsSelected(const string &Name)
+{
+    return Name.find(g_Options.m_Filter) != string::npos;
+}
+
+// Print the report's column headings...
+static void ReportHeader()
+{
+    cout << left << setw(52) << "Benchmark"
+         << right << setw(14) << "ns/op"
+         << setw(14) << "misses/op"
+         << setw(14) << "bytes/entry" << endl
+         << string(94, '-') << endl;
+}
+
+// Time the given function performing the given number of operations, then
+//  print a result row. If the function returns a number, it's shown as the
+//  bytes per entry...
+template <typename FunctionType>
+static void Measure(
+    const string &Name,
+    const size_t Operations,
+    FunctionType &&Function)
+{
+    // Bytes per entry, if the function tells us...
+    optional<double> BytesPerEntry;
+
+    // Run the function between two time points, counting cache misses...
+    g_CacheMisses.Start();
+    const auto Start = chrono::steady_clock::now();
+    if constexpr(is_void_v<invoke_result_t<FunctionType>>)
+        Function();
+    else
+        BytesPerEntry = Function();
+    const auto Stop = chrono::steady_clock::now();
+    const optional<uint64_t> CacheMisses = g_CacheMisses.Stop();
+
+    // Calculate nanoseconds per operation...
+    const double NanosecondsPerOperation =
+        chrono::duration<double, nano>(Stop - Start).count() /
+        static_cast<double>(max<size_t>(Operations, 1));
+
+    // Show the result...
+    cout << left << setw(52) << Name << right << fixed
+         << setw(14) << setprecision(1) << NanosecondsPerOperation;
+
+        // Cache misses, if known...
+        if(CacheMisses)
+            cout << setw(14) << setprecision(2)
+                 << static_cast<double>(*CacheMisses) / static_cast<double>(max<size_t>(Operations, 1));
+        else
+            cout << setw(14) << "-";
+
+        // Bytes per entry, if known...
+        if(BytesPerEntry)
+            cout << setw(14) << setprecision(1) << *BytesPerEntry;
+        else
+            cout << setw(14) << "-";
+
+    cout << endl;
+}
+
+// Bijective mixing function, so distinct inputs always give distinct
+//  pseudorandom outputs...
+static uint64_t Mix(uint64_t Value) noexcept
+{
+    Value ^= Value >> 33;
+    Value *= 0xff51afd7ed558ccdULL;
+    Value ^= Value >> 33;
+    Value *= 0xc4ceb9fe1a85ec53ULL;
+    Value ^= Value >> 33;
+    return Value;
+}
+
+// Generate the distinct key with the given index...
+template <typename KeyType>
+static KeyType MakeKey(const uint64_t Index)
+{
+    // 32-bit integers. Reversing the bits of the index gives a distinct
+    //  pseudorandom looking permutation of them...
+    if constexpr(is_same_v<KeyType, int32_t>)
+    {
+        uint32_t Value = static_cast<uint32_t>(Index);
+        uint32_t Reversed = 0;
+        for(int Bit = 0; Bit < 32; ++Bit, Value >>= 1)
+            Reversed = (Reversed << 1) | (Value & 1);
+        return static_cast<int32_t>(Reversed);
+    }
+
+    // 64-bit integers...
+    else if constexpr(is_same_v<KeyType, uint64_t>)
+        return Mix(Index);
+
+    // Strings too long for the small string buffer...
+    else
+        return "key:" + to_string(Mix(Index));
+}
+
+// Name of the given key type...
+template <typename KeyType>
+static string GetKeyName()
+{
+    if constexpr(is_same_v<KeyType, int32_t>)
+        return "int32";
+    else if constexpr(is_same_v<KeyType, uint64_t>)
+        return "uint64";
+    else
+        return "string";
+}
+
+// Detect whether a container is one of our skip lists...
+template <typename ContainerType>
+struct IsSkipList : false_type {};
+template <typename KeyType, typename ValueType, typename LessThanComparisonType,
+          int MaximumLevels, typename AllocatorType, typename TraitsType>
+struct IsSkipList<SkipList<KeyType, ValueType, LessThanComparisonType,
+                           MaximumLevels, AllocatorType, TraitsType>> : true_type {};
+
+// Detect whether a container is one of our unrolled skip lists...
+template <typename ContainerType>
+struct IsUnrolledSkipList : false_type {};
+template <typename KeyType, typename ValueType, typename LessThanComparisonType,
+          int MaximumLevels, size_t BlockBytes, typename AllocatorType, typename LevelGeneratorType>
+struct IsUnrolledSkipList<UnrolledSkipList<KeyType, ValueType, LessThanComparisonType,
+                                           MaximumLevels, BlockBytes, AllocatorType, LevelGeneratorType>>
+  : true_type {};
+
+// Detect whether a container is one of our adaptive skip lists...
+template <typename ContainerType>
+struct IsAdaptiveSkipList : false_type {};
+template <typename KeyType, typename ValueType, typename LessThanComparisonType, size_t InlineCapacity,
+          int MaximumLevels, typename AllocatorType, typename TraitsType>
+struct IsAdaptiveSkipList<AdaptiveSkipList<KeyType, ValueType, LessThanComparisonType, InlineCapacity,
+                                           MaximumLevels, AllocatorType, TraitsType>>
+  : true_type {};
+
+// Detect whether a container has our skip lists' interface...
+template <typename ContainerType>
+constexpr bool HasSkipListInterface =
+    IsSkipList<ContainerType>::value || IsUnrolledSkipList<ContainerType>::value ||
+    IsAdaptiveSkipList<ContainerType>::value;
+
+// Detect whether a container is a set rather than a map...
+template <typename ContainerType, typename = void>
+struct IsSet : false_type {};
+template <typename ContainerType>
+struct IsSet<ContainerType, void_t<typename ContainerType::key_compare>>
+  : bool_constant<is_same_v<typename ContainerType::key_type,
+                            typename ContainerType::value_type>> {};
+
+// Insert or update the given key in any of the containers...
+template <typename ContainerType, typename KeyType>
+static void ContainerInsert(ContainerType &Container, const KeyType &Key)
+{
+    if constexpr(HasSkipListInterface<ContainerType>)
+        Container.Insert(Key, 1);
+    else if constexpr(IsSet<ContainerType>::value)
+        Container.insert(Key);
+    else
+        Container.insert_or_assign(Key, 1);
+}
+
+// Check whether any of the containers has the given key...
+template <typename ContainerType, typename KeyType>
+static bool ContainerContains(const ContainerType &Container, const KeyType &Key)
+{
+    if constexpr(HasSkipListInterface<ContainerType>)
+        return Container.Search(Key) != Container.end();
+    else
+        return Container.find(Key) != Container.end();
+}
+
+// Delete the given key from any of the containers...
+template <typename ContainerType, typename KeyType>
+static void ContainerDelete(ContainerType &Container, const KeyType &Key)
+{
+    if constexpr(HasSkipListInterface<ContainerType>)
+        Container.Delete(Key);
+    else
+        Container.erase(Key);
+}
+
+// Run every workload against the given container type, key type, and
+//  size...
+template <typename ContainerType, typename KeyType>
+static void RunWorkloads(const string &ContainerName, const size_t Size)
+{
+    // Suffix of every benchmark's name...
+    const string Suffix = "/" + ContainerName + "<" + GetKeyName<KeyType>() + ">/" + to_string(Size);
+
+    // Skip generating keys if nothing is selected...
+    const char * const Workloads[] = {
+        "Insert/Random", "Insert/Sorted", "Insert/Reverse", "Insert/Hinted", "Search/Hit",
+        "Search/Miss", "SearchBatch", "Iterate", "Mixed", "Delete", "BulkLoad",
+        "InsertBatch", "DeleteBatch", "Search/AfterDelete", "Upsert",
+        "ExtractWhile"};
+    if(none_of(begin(Workloads), end(Workloads), [&](const char * const Workload)
+        { return IsSelected(Workload + Suffix); }))
+        return;
+
+    // Keys present in the container, in random order...
+    vector<KeyType> Present(Size);
+    for(size_t Index = 0; Index < Size; ++Index)
+        Present[Index] = MakeKey<KeyType>(Index);
+
+    // Keys absent from the container, in random order...
+    vector<KeyType> Absent(Size);
+    for(size_t Index = 0; Index < Size; ++Index)
+        Absent[Index] = MakeKey<KeyType>(Size + Index);
+
+    // Present keys in sorted order...
+    vector<KeyType> Sorted(Present);
+    sort(begin(Sorted), end(Sorted));
+
+    // Indices of keys to look up, repeated enough to be measurable on small
+    //  containers...
+    const size_t LookupCount = clamp<size_t>(Size, 1000000, 4000000);
+    mt19937_64 RandomGenerator(42);
+    uniform_int_distribution<size_t> IndexDistribution(0, Size - 1);
+    vector<size_t> Lookups(LookupCount);
+    generate(begin(Lookups), end(Lookups), [&] { return IndexDistribution(RandomGenerator); });
+
+    // Container built by inserting keys in random order, which the
+    //  following workloads up to and including deletion share...
+    {
+        // Insert in random order, measuring the container's footprint. This
+        //  is always done, since later workloads need the container...
+        ContainerType Container;
+        auto InsertRandom = [&]
+        {
+            const size_t LiveBytesBefore = g_LiveBytes;
+            for(const KeyType &Key : Present)
+                ContainerInsert(Container, Key);
+            return static_cast<double>(g_LiveBytes - LiveBytesBefore) /
+                   static_cast<double>(Size);
+        };
+        if(IsSelected("Insert/Random" + Suffix))
+            Measure("Insert/Random" + Suffix, Size, InsertRandom);
+        else
+            InsertRandom();
+
+        // Search for present keys...
+        if(IsSelected("Search/Hit" + Suffix))
+            Measure("Search/Hit" + Suffix, LookupCount, [&]
+            {
+                size_t Found = 0;
+                for(const size_t Index : Lookups)
+                    Found += ContainerContains(Container, Present[Index]);
+                DoNotOptimize(Found);
+            });
+
+        // Search for absent keys...
+        if(IsSelected("Search/Miss" + Suffix))
+            Measure("Search/Miss" + Suffix, LookupCount, [&]
+            {
+                size_t Found = 0;
+                for(const size_t Index : Lookups)
+                    Found += ContainerContains(Container, Absent[Index]);
+                DoNotOptimize(Found);
+            });
+
+        // Batched searches for present keys, in batches of the size a request
+        //  handler might see...
+        if constexpr(IsSkipList<ContainerType>::value)
+        {
+            if(IsSelected("SearchBatch" + Suffix))
+            {
+                vector<KeyType> BatchKeys(LookupCount);
+                for(size_t Index = 0; Index < LookupCount; ++Index)
+                    BatchKeys[Index] = Present[Lookups[Index]];
+                vector<typename ContainerType::iterator> Results(LookupCount);
+                const size_t BatchSize = 256;
+                Measure("SearchBatch" + Suffix, LookupCount, [&]
+                {
+                    for(size_t Offset = 0; Offset < LookupCount; Offset += BatchSize)
+                    {
+                        const size_t End = min(Offset + BatchSize, LookupCount);
+                        Container.SearchBatch(
+                            begin(BatchKeys) + Offset, begin(BatchKeys) + End,
+                            begin(Results) + Offset);
+                    }
+                    DoNotOptimize(Results.back());
+                });
+            }
+
+            // Update present keys' values in place, each with a single search.
+            //  Compare with Search/Hit...
+            if(IsSelected("Upsert" + Suffix))
+                Measure("Upsert" + Suffix, LookupCount, [&]
+                {
+                    for(const size_t Index : Lookups)
+                        Container.Upsert(Present[Index], [](int &Value) { ++Value; });
+                    DoNotOptimize(Container.begin()->second);
+                });
+        }
+
+        // Iterate over every entry, repeating on small containers...
+        if(IsSelected("Iterate" + Suffix))
+        {
+            const size_t Passes = max<size_t>(1, 1000000 / Size);
+            Measure("Iterate" + Suffix, Passes * Size, [&]
+            {
+                size_t Count = 0;
+                for(size_t Pass = 0; Pass < Passes; ++Pass)
+                {
+                    for(const auto &Entry : Container)
+                    {
+                        DoNotOptimize(Entry);
+                      ++Count;
+                    }
+                }
+                DoNotOptimize(Count);
+            });
+        }
+
+        // Read mostly mix of eight searches, one insertion of a new key, and
+        //  one deletion of an existing key out of every ten operations...
+        size_t Deleted = 0;
+        if(IsSelected("Mixed" + Suffix))
+            Measure("Mixed" + Suffix, Size, [&]
+            {
+                size_t Found = 0;
+                size_t Inserted = 0;
+                for(size_t Operation = 0; Operation < Size; ++Operation)
+                {
+                    switch(Operation % 10)
+                    {
+                        case 0: ContainerInsert(Container, Absent[Inserted++]); break;
+                        case 5: ContainerDelete(Container, Present[Deleted++]); break;
+                        default: Found += ContainerContains(Container, Present[Lookups[Operation]]); break;
+                    }
+                }
+                DoNotOptimize(Found);
+            });
+
+        // Delete every remaining present key in random order...
+        if(IsSelected("Delete" + Suffix))
+            Measure("Delete" + Suffix, Size - Deleted, [&]
+            {
+                for(size_t Index = Deleted; Index < Size; ++Index)
+                    ContainerDelete(Container, Present[Index]);
+            });
+    }
+
+    // Search for the few keys left after deleting nearly all of them, which
+    //  should cost no more than searching a container built with only those.
+    //  Compare with Search/Hit at a sixty-fourth of the size...
+    if(IsSelected("Search/AfterDelete" + Suffix))
+    {
+        ContainerType Container;
+        for(const KeyType &Key : Present)
+            ContainerInsert(Container, Key);
+        const size_t Survivors = max<size_t>(1, Size / 64);
+        for(size_t Index = Survivors; Index < Size; ++Index)
+            ContainerDelete(Container, Present[Index]);
+        Measure("Search/AfterDelete" + Suffix, LookupCount, [&]
+        {
+            size_t Found = 0;
+            for(const size_t Index : Lookups)
+                Found += ContainerContains(Container, Present[Index % Survivors]);
+            DoNotOptimize(Found);
+        });
+    }
+
+    // Insert in sorted order...
+    if(IsSelected("Insert/Sorted" + Suffix))
+    {
+        ContainerType Container;
+        Measure("Insert/Sorted" + Suffix, Size, [&]
+        {
+            for(const KeyType &Key : Sorted)
+                ContainerInsert(Container, Key);
+        });
+    }
+
+    // Insert in reverse sorted order...
+    if(IsSelected("Insert/Reverse" + Suffix))
+    {
+        ContainerType Container;
+        Measure("Insert/Reverse" + Suffix, Size, [&]
+        {
+            for(auto Key = Sorted.crbegin(); Key != Sorted.crend(); ++Key)
+                ContainerInsert(Container, *Key);
+        });
+    }
+
+    // Build from sorted keys in one pass...
+    if constexpr(IsSkipList<ContainerType>::value)
+    {
+        // Fill in every other key of a list holding the rest, in order, each
+        //  hinted at the key it follows. The hints are all in the middle of
+        //  the list, rather than at its tail. Compare with Insert/Sorted...
+        if(IsSelected("Insert/Hinted" + Suffix))
+        {
+            ContainerType Container;
+            vector<typename ContainerType::iterator> Hints;
+            for(size_t Index = 0; Index < Size; Index += 2)
+                Hints.push_back(Container.Insert(Container.end(), Sorted[Index], 1));
+            Measure("Insert/Hinted" + Suffix, Size / 2, [&]
+            {
+                for(size_t Index = 1; Index < Size; Index += 2)
+                    Container.Insert(Hints[Index / 2], Sorted[Index], 1);
+            });
+        }
+
+        if(IsSelected("BulkLoad" + Suffix))
+        {
+            vector<pair<KeyType, int>> SortedPairs;
+            SortedPairs.reserve(Size);
+            for(const KeyType &Key : Sorted)
+                SortedPairs.emplace_back(Key, 1);
+            ContainerType Container;
+            Measure("BulkLoad" + Suffix, Size, [&]
+            {
+                Container.BulkLoad(
+                    cbegin(SortedPairs), cend(SortedPairs), SkipListLevelAssignment::Balanced);
+            });
+        }
+
+        // Insert, then delete, the keys in random order, sorted within each
+        //  batch of the size a write path might apply at once...
+        if(IsSelected("InsertBatch" + Suffix) || IsSelected("DeleteBatch" + Suffix))
+        {
+            const size_t BatchSize = 10000;
+            vector<pair<KeyType, int>> BatchPairs;
+            BatchPairs.reserve(Size);
+            for(const KeyType &Key : Present)
+                BatchPairs.emplace_back(Key, 1);
+            vector<KeyType> BatchKeys(Present);
+            for(size_t Offset = 0; Offset < Size; Offset += BatchSize)
+            {
+                const size_t End = min(Offset + BatchSize, Size);
+                sort(begin(BatchPairs) + Offset, begin(BatchPairs) + End);
+                sort(begin(BatchKeys) + Offset, begin(BatchKeys) + End);
+            }
+            ContainerType Container;
+            auto InsertBatches = [&]
+            {
+                for(size_t Offset = 0; Offset < Size; Offset += BatchSize)
+                    Container.InsertBatch(
+                        cbegin(BatchPairs) + Offset, cbegin(BatchPairs) + min(Offset + BatchSize, Size));
+            };
+            if(IsSelected("InsertBatch" + Suffix))
+                Measure("InsertBatch" + Suffix, Size, InsertBatches);
+            else
+                InsertBatches();
+            if(IsSelected("DeleteBatch" + Suffix))
+                Measure("DeleteBatch" + Suffix, Size, [&]
+                {
+                    for(size_t Offset = 0; Offset < Size; Offset += BatchSize)
+                        Container.DeleteBatch(
+                            cbegin(BatchKeys) + Offset, cbegin(BatchKeys) + min(Offset + BatchSize, Size));
+                });
+        }
+
+        // Expire every key from the front in sweeps of a thousand, as a cache
+        //  keyed by deadline would. Compare with Delete...
+        if(IsSelected("ExtractWhile" + Suffix))
+        {
+            ContainerType Container;
+            for(const KeyType &Key : Present)
+                ContainerInsert(Container, Key);
+            const size_t SweepSize = 1000;
+            Measure("ExtractWhile" + Suffix, Size, [&]
+            {
+                size_t Extracted = 0;
+                for(size_t Offset = SweepSize; Offset < Size + SweepSize; Offset += SweepSize)
+                {
+                    Extracted += (Offset < Size)
+                        ? Container.ExtractWhile([&](const auto &KeyValue)
+                            { return KeyValue.first < Sorted[Offset]; })
+                        : Container.ExtractWhile([](const auto &) { return true; });
+                }
+                DoNotOptimize(Extracted);
+            });
+        }
+    }
+}
+
+// Traits for the skip lists we benchmark, all drawing the same levels every
+//  run so that results are reproducible...
+struct BenchmarkTraits : SkipListDeterministicTraits {};
+struct BenchmarkPrefetchTraits : SkipListDeterministicTraits
+{
+    static constexpr bool Prefetch = true;
+};
+struct BenchmarkQuarterTraits : SkipListDeterministicTraits
+{
+    using LevelGeneratorType = SkipListLevelGenerator<4, true>;
+};
+
+// Run every workload against every container for the given key type and
+//  size...
+template <typename KeyType>
+static void RunContainers(const size_t Size)
+{
+    // Our skip list, without and with prefetching, and promoting with a
+    //  probability of one quarter rather than one half...
+    RunWorkloads<SkipList<KeyType, int, less<KeyType>, 16,
+        SkipListPoolAllocator<16>, BenchmarkTraits>, KeyType>("SkipList", Size);
+    RunWorkloads<SkipList<KeyType, int, less<KeyType>, 16,
+        SkipListPoolAllocator<16>, BenchmarkPrefetchTraits>, KeyType>("SkipListPrefetch", Size);
+    RunWorkloads<SkipList<KeyType, int, less<KeyType>, 16,
+        SkipListPoolAllocator<16>, BenchmarkQuarterTraits>, KeyType>("SkipListQuarter", Size);
+
+    // Our unrolled skip list, with blocks of two cache lines of keys...
+    RunWorkloads<UnrolledSkipList<KeyType, int, less<KeyType>, 16, 128,
+        SkipListPoolAllocator<16>, SkipListLevelGenerator<2, true>>, KeyType>("UnrolledSkipList", Size);
+
+    // Standard library baselines...
+    RunWorkloads<map<KeyType, int>, KeyType>("std::map", Size);
+    RunWorkloads<set<KeyType>, KeyType>("std::set", Size);
+
+    // Abseil's B-tree baseline...
+#if defined(SKIP_LIST_BENCHMARK_ABSEIL)
+    RunWorkloads<absl::btree_map<KeyType, int>, KeyType>("absl::btree_map", Size);
+#endif
+}
+
+// Build many small containers of the same type, each holding the same few
+//  keys out of the given number in total, then search them all. This is how
+//  lists nested inside another structure are typically used, and where
+//  keeping them inline should pay off...
+template <typename ContainerType, typename KeyType>
+static void RunSmall(const string &ContainerName, const size_t Size)
+{
+    // Suffix of every benchmark's name...
+    const string Suffix = "/" + ContainerName + "<" + GetKeyName<KeyType>() + ">/" + to_string(Size);
+    if(!IsSelected("Small/Insert" + Suffix) && !IsSelected("Small/Search" + Suffix))
+        return;
+
+    // Keys each container holds, in random order...
+    const size_t KeysPerContainer = 48;
+    vector<KeyType> Keys(KeysPerContainer);
+    for(size_t Index = 0; Index < KeysPerContainer; ++Index)
+        Keys[Index] = MakeKey<KeyType>(Index);
+
+    // Fill every container, measuring their footprint. This is always done,
+    //  since searching needs them...
+    vector<ContainerType> Containers(Size / KeysPerContainer);
+    auto Insert = [&]
+    {
+        const size_t LiveBytesBefore = g_LiveBytes;
+        for(ContainerType &Container : Containers)
+            for(const KeyType &Key : Keys)
+                ContainerInsert(Container, Key);
+        return static_cast<double>(g_LiveBytes - LiveBytesBefore) /
+               static_cast<double>(Containers.size() * KeysPerContainer);
+    };
+    if(IsSelected("Small/Insert" + Suffix))
+        Measure("Small/Insert" + Suffix, Containers.size() * KeysPerContainer, Insert);
+    else
+        Insert();
+
+    // Search every container for every key...
+    if(IsSelected("Small/Search" + Suffix))
+        Measure("Small/Search" + Suffix, Containers.size() * KeysPerContainer, [&]
+        {
+            size_t Found = 0;
+            for(const ContainerType &Container : Containers)
+                for(const KeyType &Key : Keys)
+                    Found += ContainerContains(Container, Key);
+            DoNotOptimize(Found);
+        });
+}
+
+// Run the small container benchmarks for the given total number of keys...
+template <typename KeyType>
+static void RunSmalls(const size_t Size)
+{
+    RunSmall<SkipList<KeyType, int>, KeyType>("SkipList", Size);
+    RunSmall<AdaptiveSkipList<KeyType, int>, KeyType>("AdaptiveSkipList", Size);
+    RunSmall<map<KeyType, int>, KeyType>("std::map", Size);
+}
+
+// Skip list shared between threads behind a single lock, the baseline the
+//  concurrent skip list should scale beyond...
+template <typename KeyType>
+class LockedSkipList
+{
+    // Public methods...
+    public:
+
+        // Check whether the given key exists...
+        bool Contains(const KeyType &Key) const
+        {
+            const lock_guard<mutex> Lock(m_Mutex);
+            return m_List.Search(Key) != m_List.cend();
+        }
+
+        // Delete the given key...
+        size_t Delete(const KeyType &Key)
+        {
+            const lock_guard<mutex> Lock(m_Mutex);
+            return m_List.Delete(Key);
+        }
+
+        // Insert or update the given key...
+        bool Insert(KeyType Key, int Value)
+        {
+            const lock_guard<mutex> Lock(m_Mutex);
+            m_List.Insert(move(Key), Value);
+            return true;
+        }
+
+    // Protected attributes...
+    protected:
+
+        // Lock serializing every operation...
+        mutable mutex           m_Mutex;
+
+        // The list itself...
+        SkipList<KeyType, int>  m_List;
+};
+
+// Run a read mostly mix of searches, insertions, and deletions from the given
+//  number of threads at once against a container shared between them, with
+//  half of the keys present on average. Nanoseconds per operation are for the
+//  whole process, so perfect scaling halves them each time the number of
+//  threads doubles...
+template <typename ContainerType, typename KeyType>
+static void RunScaling(
+    const string &ContainerName,
+    const size_t Size,
+    const unsigned ThreadCount)
+{
+    // Benchmark's name...
+    const string Name =
+        "Scaling/" + ContainerName + "<" + GetKeyName<KeyType>() + ">/" +
+        to_string(Size) + "/" + to_string(ThreadCount);
+    if(!IsSelected(Name))
+        return;
+
+    // Keys that may be present, the first half of which start out so...
+    vector<KeyType> Keys(2 * Size);
+    for(size_t Index = 0; Index < Keys.size(); ++Index)
+        Keys[Index] = MakeKey<KeyType>(Index);
+    ContainerType Container;
+    for(size_t Index = 0; Index < Size; ++Index)
+        Container.Insert(Keys[Index], 1);
+
+    // Operations each thread performs...
+    const size_t OperationsPerThread = 1000000;
+
+    // Start every thread waiting for the signal to begin...
+    atomic<bool> Begin(false);
+    vector<thread> Threads;
+    for(unsigned ThreadIndex = 0; ThreadIndex < ThreadCount; ++ThreadIndex)
+    {
+        Threads.emplace_back([&, ThreadIndex]
+        {
+            // Wait for every other thread...
+            while(!Begin.load(memory_order_acquire))
+                this_thread::yield();
+
+            // Each thread draws its own keys and operations. Eight in ten
+            //  operations search, the rest insert or delete...
+            size_t Found = 0;
+            for(size_t Index = 0; Index < OperationsPerThread; ++Index)
+            {
+                const uint64_t Draw = Mix(ThreadIndex * OperationsPerThread + Index);
+                const KeyType &Key = Keys[(Draw >> 8) % Keys.size()];
+                const unsigned Operation = (Draw & 0xFF) % 10;
+                if(Operation < 8)
+                    Found += Container.Contains(Key);
+                else if(Operation == 8)
+                    Container.Insert(Key, 1);
+                else
+                    Container.Delete(Key);
+            }
+            DoNotOptimize(Found);
+        });
+    }
+
+    // Time every thread from the signal until the last finishes...
+    Measure(Name, OperationsPerThread * ThreadCount, [&]
+    {
+        Begin.store(true, memory_order_release);
+        for(thread &Thread : Threads)
+            Thread.join();
+    });
+}
+
+// Run the scaling benchmarks for the given size, doubling the number of
+//  threads each time up to the maximum requested...
+static void RunScalings(const size_t Size)
+{
+    for(unsigned ThreadCount = 1;; ThreadCount = min(2 * ThreadCount, g_Options.m_MaximumThreads))
+    {
+        RunScaling<ConcurrentSkipList<uint64_t, int>, uint64_t>("ConcurrentSkipList", Size, ThreadCount);
+        RunScaling<LazySkipList<uint64_t, int>, uint64_t>("LazySkipList", Size, ThreadCount);
+        RunScaling<LockedSkipList<uint64_t>, uint64_t>("LockedSkipList", Size, ThreadCount);
+        if(ThreadCount == g_Options.m_MaximumThreads)
+            break;
+    }
+}
+
+// Entry point...
+int main(int ArgumentCount, char *Arguments[])
+{
+    // Parse command line options...
+    for(int Index = 1; Index < ArgumentCount; ++Index)
+    {
+        const string Argument = Arguments[Index];
+        if(Argument.rfind("--max-size=", 0) == 0)
+            g_Options.m_MaximumSize = strtoull(Argument.c_str() + 11, nullptr, 10);
+        else if(Argument.rfind("--filter=", 0) == 0)
+            g_Options.m_Filter = Argument.substr(9);
+        else if(Argument.rfind("--max-threads=", 0) == 0)
+            g_Options.m_MaximumThreads = max(
+                static_cast<unsigned>(strtoul(Argument.c_str() + 14, nullptr, 10)), 1u);
+        else
+        {
+            cerr << "Usage: " << Arguments[0] << " [--max-size=N] [--max-threads=N] [--filter=SUBSTRING]" << endl;
+            return 1;
+        }
+    }
+
+    // Show column headings...
+    ReportHeader();
+
+    // Benchmark each size from one thousand up by factors of ten to the
+    //  maximum requested, for each key type...
+    for(size_t Size = 1000; Size <= g_Options.m_MaximumSize; Size *= 10)
+    {
+        RunContainers<int32_t>(Size);
+        RunContainers<uint64_t>(Size);
+        RunContainers<string>(Size);
+        RunSmalls<uint64_t>(Size);
+        RunSmalls<string>(Size);
+        RunScalings(Size);
+    }
+
+    return 0;
+}
+
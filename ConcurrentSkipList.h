@@ -0,0 +1,1507 @@
+/*
+    Copyright (C) 2024-2025 Cartesian Theatre. All rights reserved.
+*/
+
+// Multiple include protection...
+#ifndef _CONCURRENT_SKIP_LIST_H_
+#define _CONCURRENT_SKIP_LIST_H_
+
+// Includes...
+
+    // Standard C++ / POSIX system headers...
+    #include <algorithm>
+    #include <array>
+    #include <atomic>
+    #include <cassert>
+    #include <cstddef>
+    #include <cstdint>
+    #include <functional>
+    #include <memory>
+    #include <new>
+    #include <optional>
+    #include <random>
+    #include <thread>
+    #include <utility>
+    #include <vector>
+
+// Epoch based memory reclamation shared by every concurrent skip list. Threads
+//  pin the current epoch with a guard for the duration of each operation.
+//  Objects that have been made unreachable are retired along with the epoch
+//  at the time, and are only destroyed once the global epoch has advanced
+//  twice beyond it. The epoch can only advance once every pinned thread has
+//  observed the current one, so no thread that could still hold a reference
+//  to a retired object can be pinned by then. Readers never block...
+class SkipListEpochDomain
+{
+    // Protected forward declarations...
+    protected:
+
+        // Per thread record will be defined later...
+        struct ThreadRecordType;
+
+    // Public types...
+    public:
+
+        // Function that destroys a retired object...
+        using DeleterType = void (*)(void *Object) noexcept;
+
+        // Pins the current epoch for the calling thread for as long as it
+        //  lives. Guards may be nested...
+        class GuardType
+        {
+            // Public methods...
+            public:
+
+                // Constructor pins the current epoch...
+                explicit GuardType(SkipListEpochDomain &Domain = GetInstance())
+                  : m_Domain(Domain),
+                    m_Record(Domain.GetThreadRecord())
+                {
+                    m_Domain.Pin(m_Record);
+                }
+
+                // Guards are tied to the scope that created them...
+                GuardType(const GuardType &) = delete;
+                GuardType &operator=(const GuardType &) = delete;
+
+                // Destructor releases the pin...
+               ~GuardType()
+                {
+                    m_Domain.Unpin(m_Record);
+                }
+
+            // Protected attributes...
+            protected:
+
+                // Domain we have pinned...
+                SkipListEpochDomain    &m_Domain;
+
+                // Calling thread's record...
+                ThreadRecordType       &m_Record;
+        };
+
+    // Public methods...
+    public:
+
+        // Domains are shared by reference only...
+        SkipListEpochDomain(const SkipListEpochDomain &) = delete;
+        SkipListEpochDomain &operator=(const SkipListEpochDomain &) = delete;
+
+        // Get the domain shared by every concurrent skip list...
+        static SkipListEpochDomain &GetInstance()
+        {
+            static SkipListEpochDomain Domain;
+            return Domain;
+        }
+
+        // Retire the given object, which must already be unreachable to any
+        //  thread that pins the domain from now on. The calling thread must
+        //  have the domain pinned. It will be destroyed with the given deleter
+        //  once no pinned thread could still refer to it...
+        void Retire(void * const Object, const DeleterType Deleter)
+        {
+            // Calling thread's record...
+            ThreadRecordType &Record = GetThreadRecord();
+            assert(Record.m_Nesting > 0);
+
+            // Remember the object along with the current epoch...
+            Record.m_Retired.push_back(
+                {Object, Deleter, m_GlobalEpoch.load(std::memory_order_seq_cst)});
+
+            // Every so often try to advance the epoch and destroy what we can...
+            if(Record.m_Retired.size() >= CollectThreshold)
+            {
+                TryAdvance();
+                Collect(Record);
+            }
+        }
+
+        // Destructor destroys everything still retired. No thread may be
+        //  pinned by now...
+       ~SkipListEpochDomain()
+        {
+            for(ThreadRecordType *Record = m_Records.load(); Record;)
+            {
+                for(const RetiredType &Retired : Record->m_Retired)
+                    Retired.m_Deleter(Retired.m_Object);
+                ThreadRecordType * const NextRecord = Record->m_Next;
+                delete Record;
+                Record = NextRecord;
+            }
+        }
+
+    // Protected types...
+    protected:
+
+        // An object awaiting destruction...
+        struct RetiredType
+        {
+            // The object...
+            void               *m_Object;
+
+            // How to destroy it...
+            DeleterType         m_Deleter;
+
+            // Global epoch when it was retired...
+            std::uint64_t       m_Epoch;
+        };
+
+        // State for each thread that has used the domain. Records are never
+        //  freed while the domain exists, but are reused by new threads after
+        //  the thread that owned them exits...
+        struct alignas(64) ThreadRecordType
+        {
+            // Epoch last pinned, shifted left once, with the lowest bit set
+            //  while pinned...
+            std::atomic<std::uint64_t>  m_State{0};
+
+            // Whether a living thread owns this record...
+            std::atomic<bool>           m_InUse{true};
+
+            // Depth of nested guards, only used by the owning thread...
+            unsigned                    m_Nesting{0};
+
+            // Objects this thread has retired but not yet destroyed...
+            std::vector<RetiredType>    m_Retired;
+
+            // Next record in the domain, which never changes once linked...
+            ThreadRecordType           *m_Next{nullptr};
+        };
+
+        // Releases the calling thread's record when it exits...
+        struct ThreadRecordOwnerType
+        {
+            // Record owned, if any...
+            ThreadRecordType   *m_Record{nullptr};
+
+            // Destructor lets another thread adopt the record...
+           ~ThreadRecordOwnerType()
+            {
+                if(m_Record)
+                    m_Record->m_InUse.store(false, std::memory_order_release);
+            }
+        };
+
+    // Protected constants...
+    protected:
+
+        // Number of retired objects a thread accumulates before trying to
+        //  destroy them...
+        static constexpr std::size_t CollectThreshold = 64;
+
+    // Protected methods...
+    protected:
+
+        // Constructor is only called by GetInstance(), since each thread
+        //  caches a single record and would otherwise pin and retire into
+        //  whichever domain it used first...
+        SkipListEpochDomain() noexcept
+          : m_GlobalEpoch(0),
+            m_Records(nullptr)
+        {
+        }
+
+        // Destroy every object the given thread's record retired at least two
+        //  epochs ago...
+        void Collect(ThreadRecordType &Record) noexcept
+        {
+            // Current epoch...
+            const std::uint64_t GlobalEpoch = m_GlobalEpoch.load(std::memory_order_seq_cst);
+
+            // Separate those that are safe to destroy to the end...
+            const auto Safe = std::partition(
+                Record.m_Retired.begin(), Record.m_Retired.end(),
+                [GlobalEpoch](const RetiredType &Retired)
+                    { return Retired.m_Epoch + 2 > GlobalEpoch; });
+
+            // Destroy them...
+            for(auto Retired = Safe; Retired != Record.m_Retired.end(); ++Retired)
+                Retired->m_Deleter(Retired->m_Object);
+            Record.m_Retired.erase(Safe, Record.m_Retired.end());
+        }
+
+        // Get the calling thread's record, adopting an unused one or creating
+        //  a new one the first time. A thread only ever has one, which is
+        //  why there is only ever one domain...
+        ThreadRecordType &GetThreadRecord()
+        {
+            // Our record, if we have one yet...
+            thread_local ThreadRecordOwnerType Owner;
+            if(Owner.m_Record)
+                return *Owner.m_Record;
+
+            // Try to adopt a record left behind by a thread that exited...
+            for(ThreadRecordType *Record = m_Records.load(std::memory_order_acquire);
+                Record;
+                Record = Record->m_Next)
+            {
+                bool InUse = false;
+                if(Record->m_InUse.compare_exchange_strong(InUse, true, std::memory_order_acq_rel))
+                    return *(Owner.m_Record = Record);
+            }
+
+            // Otherwise create one and push it onto the list of records...
+            ThreadRecordType * const Record = new ThreadRecordType;
+            Record->m_Next = m_Records.load(std::memory_order_relaxed);
+            while(!m_Records.compare_exchange_weak(
+                Record->m_Next, Record, std::memory_order_release, std::memory_order_relaxed))
+                ;
+            return *(Owner.m_Record = Record);
+        }
+
+        // Pin the current epoch for the given thread...
+        void Pin(ThreadRecordType &Record) noexcept
+        {
+            // Nothing more to do for a nested guard...
+            if(Record.m_Nesting++ > 0)
+                return;
+
+            // Announce that we are pinned in the current epoch. Every load
+            //  the list makes afterwards is sequentially consistent, so none
+            //  can be ordered before the announcement...
+            const std::uint64_t GlobalEpoch = m_GlobalEpoch.load(std::memory_order_seq_cst);
+            Record.m_State.store((GlobalEpoch << 1) | 1, std::memory_order_seq_cst);
+        }
+
+        // Try to advance the global epoch, which is only possible once every
+        //  pinned thread has observed the current one...
+        void TryAdvance() noexcept
+        {
+            // Current epoch...
+            std::uint64_t GlobalEpoch = m_GlobalEpoch.load(std::memory_order_seq_cst);
+
+            // Check every pinned thread is in it...
+            for(const ThreadRecordType *Record = m_Records.load(std::memory_order_acquire);
+                Record;
+                Record = Record->m_Next)
+            {
+                const std::uint64_t State = Record->m_State.load(std::memory_order_seq_cst);
+                if((State & 1) && ((State >> 1) != GlobalEpoch))
+                    return;
+            }
+
+            // Advance it, unless another thread beat us to it...
+            m_GlobalEpoch.compare_exchange_strong(GlobalEpoch, GlobalEpoch + 1, std::memory_order_seq_cst);
+        }
+
+        // Release the given thread's pin...
+        void Unpin(ThreadRecordType &Record) noexcept
+        {
+            // Only the outermost guard releases the pin...
+            if(--Record.m_Nesting > 0)
+                return;
+
+            // Announce we are no longer pinned...
+            Record.m_State.store(
+                Record.m_State.load(std::memory_order_relaxed) & ~std::uint64_t(1),
+                std::memory_order_release);
+        }
+
+    // Protected attributes...
+    protected:
+
+        // Global epoch...
+        std::atomic<std::uint64_t>      m_GlobalEpoch;
+
+        // Every thread record ever created, most recent first...
+        std::atomic<ThreadRecordType *> m_Records;
+};
+
+// Random levels for the concurrent skip lists. Each thread draws from its own
+//  generator, so no state is shared between them...
+template <int MaximumLevels>
+class SkipListThreadLevelGenerator
+{
+    // Public methods...
+    public:
+
+        // Select a random level from the calling thread's generator...
+        static int GetRandomLevel() noexcept
+        {
+            // Each thread's xorshift generator state, seeded once...
+            thread_local std::uint64_t State =
+                (static_cast<std::uint64_t>(std::random_device()()) << 32) |
+                (std::hash<std::thread::id>()(std::this_thread::get_id()) | 1);
+
+            // Advance the generator...
+            State ^= State << 13;
+            State ^= State >> 7;
+            State ^= State << 17;
+
+            // Each trailing one bit is a coin flip that landed heads, never
+            //  increasing the level of the new node passed the maximum
+            //  permissible...
+            int CurrentLevel = 0;
+            for(std::uint64_t Bits = State; (Bits & 1) && (CurrentLevel < (MaximumLevels - 1)); Bits >>= 1)
+              ++CurrentLevel;
+
+            // Return the proposed node's level...
+            return CurrentLevel;
+        }
+};
+
+// Lock-free concurrent skip list, safe to use from any number of threads at
+//  once without external locking. It follows Fraser's and Herlihy and Shavit's
+//  designs. Each forward pointer carries a mark in its lowest bit that
+//  logically deletes the node it belongs to. A node is deleted by marking
+//  each of its levels from the top down, with the thread that marks the
+//  bottom level being the one that deleted it. Searches physically unlink
+//  marked nodes they pass over with a compare-and-swap. Nodes are reclaimed
+//  through the shared epoch domain once both the thread that inserted a node
+//  and the thread that deleted it have finished with it.
+//
+//  Unlike SkipList, an existing key's value is never updated by Insert(), and
+//  Search() returns a copy of the value, because another thread may delete
+//  the node at any moment. Nodes come from the free store rather than a node
+//  allocator, since they are destroyed by whichever thread reclaims them...
+template
+<
+    typename    KeyType,                                                        /* Key type */
+    typename    ValueType,                                                      /* Value type associated with key */
+    typename    LessThanComparisonType = decltype(std::less<KeyType>()),        /* How to compare keys to each other */
+    int         MaximumLevels = 16                                              /* Maximum number of levels, each indexed from [0, MaximumLevel) */
+>
+class ConcurrentSkipList
+{
+    // Protected forward declarations...
+    protected:
+
+        // Node type will be defined later...
+        class NodeType;
+
+    // Public types...
+    public:
+
+        // Key-value type...
+        using KeyValueType      = std::pair<const KeyType, ValueType>;
+
+        // Type alias for how we count elements...
+        using size_type         = std::size_t;
+
+    // Public methods...
+    public:
+
+        // Constructor...
+        explicit ConcurrentSkipList(
+            const LessThanComparisonType &LessThanCompare = LessThanComparisonType())
+          : m_Header(CreateNode(MaximumLevels)),
+            m_HighestLevel(0),
+            m_LessThanComparison(LessThanCompare),
+            m_Domain(SkipListEpochDomain::GetInstance()),
+            m_Size(0)
+        {
+        }
+
+        // Nodes are owned by exactly one list...
+        ConcurrentSkipList(const ConcurrentSkipList &) = delete;
+        ConcurrentSkipList &operator=(const ConcurrentSkipList &) = delete;
+
+        // Check whether the given key exists...
+        bool Contains(const KeyType &Key) const
+        {
+            // Keep anything we find from being reclaimed while we look...
+            const SkipListEpochDomain::GuardType Guard(m_Domain);
+            return FindNode(Key) != nullptr;
+        }
+
+        // Delete the given key and its associated value if the key exists.
+        //  Return number of deleted elements, which should be either zero or
+        //  one...
+        size_type Delete(const KeyType &Key)
+        {
+            // Keep anything we find from being reclaimed while we look...
+            const SkipListEpochDomain::GuardType Guard(m_Domain);
+
+            // Find the node to delete...
+            typename NodeType::NodePointersType Predecessors;
+            typename NodeType::NodePointersType Successors;
+            if(!Seek(Key, Predecessors, Successors))
+                return 0;
+            NodeType * const Victim = Successors[0];
+
+            // Logically delete it from each level above the bottom, from the
+            //  top down, by marking its forward pointers...
+            for(int CurrentLevel = Victim->GetLevel() - 1; CurrentLevel > 0; --CurrentLevel)
+                Victim->MarkForwardPointer(CurrentLevel);
+
+            // Marking the bottom level decides which thread deleted it. If
+            //  another thread marked it first, then it already deleted the
+            //  key...
+            if(!Victim->MarkForwardPointer(0))
+                return 0;
+
+            // Physically unlink it from every level it's linked into...
+            Seek(Key, Predecessors, Successors);
+
+            // Update the number of elements...
+            m_Size.fetch_sub(1, std::memory_order_relaxed);
+
+            // Reclaim it if the thread that inserted it has also finished
+            //  linking it...
+            if(Victim->Finish(NodeType::DeleteFinished))
+                Retire(Victim);
+
+            // Signal to user deletion of a single element...
+            return 1;
+        }
+
+        // Get the number of elements. While other threads are modifying the
+        //  list, this is only a snapshot...
+        size_type GetSize() const noexcept { return m_Size.load(std::memory_order_relaxed); }
+
+        // Insert the given key and value if the key does not exist, returning
+        //  true. Otherwise leave the existing value untouched and return
+        //  false...
+        bool Insert(KeyType Key, ValueType Value)
+        {
+            // Keep anything we find from being reclaimed while we look...
+            const SkipListEpochDomain::GuardType Guard(m_Domain);
+
+            // Level the new node will have...
+            const int NewLevel = GetRandomLevel();
+
+            // Raise the highest level in use to the new node's before
+            //  searching, so the search finds its neighbours on every level it
+            //  will be linked into...
+            int HighestLevel = m_HighestLevel.load(std::memory_order_seq_cst);
+            while((HighestLevel < NewLevel) &&
+                  !m_HighestLevel.compare_exchange_weak(HighestLevel, NewLevel, std::memory_order_seq_cst))
+                ;
+
+            // New node, once we've created it...
+            NodeType *NewNode = nullptr;
+
+            // Nodes on the left and right of where the key belongs on each
+            //  level...
+            typename NodeType::NodePointersType Predecessors;
+            typename NodeType::NodePointersType Successors;
+
+            // Link the new node into the bottom level, which is when it
+            //  becomes part of the list...
+            while(true)
+            {
+                // If the key already exists we are done, discarding any node
+                //  we created that was never linked. Once we've created it,
+                //  the key was moved into it, so search for its copy...
+                if(Seek(NewNode ? NewNode->GetKey() : Key, Predecessors, Successors))
+                {
+                    if(NewNode)
+                        DestroyNode(NewNode);
+                    return false;
+                }
+
+                // Create the new node, moving the key and value into it, if
+                //  we haven't already...
+                if(!NewNode)
+                    NewNode = CreateNode(NewLevel + 1, std::move(Key), std::move(Value));
+
+                // Point it at its successor on each level...
+                for(int CurrentLevel = 0; CurrentLevel <= NewLevel; ++CurrentLevel)
+                    NewNode->StoreForwardPointer(CurrentLevel, Successors[CurrentLevel]);
+
+                // Try to link it in after its predecessor on the bottom level.
+                //  If something changed, search again...
+                if(Predecessors[0]->CompareExchangeForwardPointer(0, Successors[0], NewNode))
+                    break;
+            }
+
+            // Update the number of elements...
+            m_Size.fetch_add(1, std::memory_order_relaxed);
+
+            // Link it into every level above, unless it is deleted in the
+            //  meantime...
+            for(int CurrentLevel = 1; CurrentLevel <= NewLevel; ++CurrentLevel)
+            {
+                while(true)
+                {
+                    // Make sure the new node points at the current successor
+                    //  on this level. If this fails, it has been marked for
+                    //  deletion and we stop linking...
+                    if(!NewNode->UpdateForwardPointer(CurrentLevel, Successors[CurrentLevel]))
+                        goto FinishedLinking;
+
+                    // Try to link it in after its predecessor...
+                    if(Predecessors[CurrentLevel]->CompareExchangeForwardPointer(
+                        CurrentLevel, Successors[CurrentLevel], NewNode))
+                        break;
+
+                    // Something changed, so search again. If our node is no
+                    //  longer the one with our key, it has been deleted...
+                    if(!Seek(NewNode->GetKey(), Predecessors, Successors) ||
+                       (Successors[0] != NewNode))
+                        goto FinishedLinking;
+                }
+            }
+
+        FinishedLinking:
+
+            // If our node was deleted while we were linking it, a level we
+            //  linked could have been missed by the deleting thread, so make
+            //  sure it's unlinked everywhere...
+            if(NewNode->IsMarked())
+                Seek(NewNode->GetKey(), Predecessors, Successors);
+
+            // Reclaim it if it was deleted and the thread that deleted it has
+            //  also finished with it...
+            if(NewNode->Finish(NodeType::InsertFinished))
+                Retire(NewNode);
+
+            // Signal the key was inserted...
+            return true;
+        }
+
+        // Search for the given key, returning a copy of its value if found...
+        std::optional<ValueType> Search(const KeyType &Key) const
+        {
+            // Keep anything we find from being reclaimed while we copy it...
+            const SkipListEpochDomain::GuardType Guard(m_Domain);
+
+            // Copy the value if we found it...
+            if(const NodeType * const Node = FindNode(Key))
+                return Node->GetValue();
+            else
+                return std::nullopt;
+        }
+
+        // Destructor. No other thread may be using the list by now...
+       ~ConcurrentSkipList()
+        {
+            // Every node still linked into the bottom level is ours to
+            //  destroy. Any that were unlinked have been retired already...
+            NodeType *CurrentNode = m_Header;
+            while(CurrentNode)
+            {
+                NodeType * const NextNode = CurrentNode->GetForwardPointer(0);
+                DestroyNode(CurrentNode);
+                CurrentNode = NextNode;
+            }
+        }
+
+    // Protected types...
+    protected:
+
+        // Node type. As with SkipList, each node and its tower of forward
+        //  pointers live in a single allocation sized to the node's own
+        //  height. Each forward pointer is atomic, with its lowest bit marking
+        //  the node it belongs to as deleted on that level...
+        class alignas(KeyValueType) alignas(std::atomic<std::uintptr_t>) NodeType
+        {
+            // Public types...
+            public:
+
+                // Node pointers large enough to track one node for every
+                //  possible level, such as during a search...
+                using NodePointersType = std::array<NodeType *, MaximumLevels>;
+
+            // Public constants...
+            public:
+
+                // Flag set once the inserting thread has finished linking...
+                static constexpr unsigned InsertFinished = 1;
+
+                // Flag set once the deleting thread has finished unlinking...
+                static constexpr unsigned DeleteFinished = 2;
+
+            // Public methods...
+            public:
+
+                // Construct by height, with the key and value pair constructed
+                //  in place from the remaining arguments, or default
+                //  initialized if there are none...
+                template <typename... ArgumentTypes>
+                explicit NodeType(const int Height, ArgumentTypes &&... Arguments)
+                  : m_KeyValue(std::forward<ArgumentTypes>(Arguments)...),
+                    m_Height(Height),
+                    m_Finished(0)
+                {
+                    // Start with every forward pointer in the tower null...
+                    for(int CurrentLevel = 0; CurrentLevel < m_Height; ++CurrentLevel)
+                        new(GetForwardPointers() + CurrentLevel) std::atomic<std::uintptr_t>(0);
+                }
+
+                // Nodes are always created in place within storage large
+                //  enough for their tower, so they can never be copied...
+                NodeType(const NodeType &) = delete;
+                NodeType &operator=(const NodeType &) = delete;
+
+                // Try to replace the given level's forward pointer, but only
+                //  if it's unmarked and still points to the expected node...
+                bool CompareExchangeForwardPointer(
+                    const int Level,
+                    NodeType * const Expected,
+                    NodeType * const Desired) noexcept
+                {
+                    std::uintptr_t ExpectedWord = ToWord(Expected);
+                    return GetForwardPointers()[Level].compare_exchange_strong(
+                        ExpectedWord, ToWord(Desired), std::memory_order_seq_cst);
+                }
+
+                // Flag that the inserting or deleting thread has finished with
+                //  the node, returning true if the other already had, in which
+                //  case the node is now unreachable and ready to reclaim...
+                bool Finish(const unsigned Flag) noexcept
+                {
+                    const unsigned Previous = m_Finished.fetch_or(Flag, std::memory_order_seq_cst);
+                    return (Previous | Flag) == (InsertFinished | DeleteFinished);
+                }
+
+                // Calculate the number of bytes needed to store a node with
+                //  the given height, including its tower...
+                static constexpr std::size_t GetAllocationSize(const int Height) noexcept
+                {
+                    return sizeof(NodeType) +
+                        (static_cast<std::size_t>(Height) * sizeof(std::atomic<std::uintptr_t>));
+                }
+
+                // Get the given level's forward pointer, ignoring its mark...
+                NodeType *GetForwardPointer(const int Level) const noexcept
+                {
+                    return ToNode(LoadForwardWord(Level));
+                }
+
+                // Get the key...
+                const KeyType &GetKey() const noexcept { return m_KeyValue.first; }
+
+                // Get the level, or the number of levels in the list this node
+                //  participates in and hence the height of its tower...
+                int GetLevel() const noexcept { return m_Height; }
+
+                // Get the value...
+                const ValueType &GetValue() const noexcept { return m_KeyValue.second; }
+
+                // Check whether the node has been deleted from the bottom
+                //  level...
+                bool IsMarked() const noexcept
+                {
+                    return IsMarkedWord(LoadForwardWord(0));
+                }
+
+                // Get the given level's forward pointer along with its mark...
+                std::uintptr_t LoadForwardWord(const int Level) const noexcept
+                {
+                    assert(Level < m_Height);
+                    return GetForwardPointers()[Level].load(std::memory_order_seq_cst);
+                }
+
+                // Mark the given level's forward pointer, returning true if we
+                //  were the thread that did so...
+                bool MarkForwardPointer(const int Level) noexcept
+                {
+                    std::uintptr_t Word = LoadForwardWord(Level);
+                    while(!IsMarkedWord(Word))
+                    {
+                        if(GetForwardPointers()[Level].compare_exchange_weak(
+                            Word, Word | 1, std::memory_order_seq_cst))
+                            return true;
+                    }
+                    return false;
+                }
+
+                // Set the given level's forward pointer before the node has
+                //  been linked into any level...
+                void StoreForwardPointer(const int Level, NodeType * const Node) noexcept
+                {
+                    GetForwardPointers()[Level].store(ToWord(Node), std::memory_order_relaxed);
+                }
+
+                // Point the given level's forward pointer at the given node
+                //  unless it has been marked, returning false if it has...
+                bool UpdateForwardPointer(const int Level, NodeType * const Node) noexcept
+                {
+                    std::uintptr_t Word = LoadForwardWord(Level);
+                    while(!IsMarkedWord(Word))
+                    {
+                        if((Word == ToWord(Node)) ||
+                           GetForwardPointers()[Level].compare_exchange_weak(
+                               Word, ToWord(Node), std::memory_order_seq_cst))
+                            return true;
+                    }
+                    return false;
+                }
+
+                // Check whether a forward pointer word is marked...
+                static bool IsMarkedWord(const std::uintptr_t Word) noexcept { return Word & 1; }
+
+                // Convert a forward pointer word to the node it points to...
+                static NodeType *ToNode(const std::uintptr_t Word) noexcept
+                {
+                    return reinterpret_cast<NodeType *>(Word & ~std::uintptr_t(1));
+                }
+
+                // Convert a node to an unmarked forward pointer word...
+                static std::uintptr_t ToWord(const NodeType * const Node) noexcept
+                {
+                    return reinterpret_cast<std::uintptr_t>(Node);
+                }
+
+            // Protected methods...
+            protected:
+
+                // Get the start of the tower which begins immediately after
+                //  the node object itself...
+                std::atomic<std::uintptr_t> *GetForwardPointers() const noexcept
+                {
+                    return reinterpret_cast<std::atomic<std::uintptr_t> *>(
+                        const_cast<std::byte *>(reinterpret_cast<const std::byte *>(this)) + sizeof(NodeType));
+                }
+
+            // Protected attributes...
+            protected:
+
+                // Key and value pair...
+                KeyValueType            m_KeyValue;
+
+                // Number of forward pointers in the tower following us...
+                int                     m_Height;
+
+                // Which of the inserting and deleting threads have finished...
+                std::atomic<unsigned>   m_Finished;
+        };
+
+    // Protected methods...
+    protected:
+
+        // Allocate and construct a node of the given height, forwarding the
+        //  remaining arguments to its constructor...
+        template <typename... ArgumentTypes>
+        static NodeType *CreateNode(const int Height, ArgumentTypes &&... Arguments)
+        {
+            // Allocate storage for the node and its tower together...
+            void * const Storage = ::operator new(NodeType::GetAllocationSize(Height));
+
+            // Construct the node in place, releasing the storage if the key or
+            //  value threw during construction...
+            try
+            {
+                return new(Storage) NodeType(
+                    Height, std::forward<ArgumentTypes>(Arguments)...);
+            }
+            catch(...)
+            {
+                ::operator delete(Storage);
+                throw;
+            }
+        }
+
+        // Destroy and de-allocate the given node...
+        static void DestroyNode(NodeType * const Node) noexcept
+        {
+            Node->~NodeType();
+            ::operator delete(Node);
+        }
+
+        // Find the unmarked node with the given key without modifying the
+        //  list, returning null if there isn't one. The caller must have the
+        //  domain pinned...
+        const NodeType *FindNode(const KeyType &Key) const
+        {
+            // Start with the header node...
+            const NodeType *CurrentNode = m_Header;
+
+            // Examine each level, from the highest level to the lowest...
+            const NodeType *NextNode = nullptr;
+            for(int CurrentLevel = m_HighestLevel.load(std::memory_order_seq_cst);
+                CurrentLevel >= 0;
+                --CurrentLevel)
+            {
+                // Keep moving right on this level, passing over any marked
+                //  nodes, as far as we can without overshooting the key...
+                NextNode = CurrentNode->GetForwardPointer(CurrentLevel);
+                while(NextNode)
+                {
+                    // Pass over a marked node...
+                    const std::uintptr_t NextWord = NextNode->LoadForwardWord(CurrentLevel);
+                    if(NodeType::IsMarkedWord(NextWord))
+                        NextNode = NodeType::ToNode(NextWord);
+
+                    // Advance if it doesn't overshoot...
+                    else if(m_LessThanComparison(NextNode->GetKey(), Key))
+                    {
+                        CurrentNode = NextNode;
+                        NextNode    = NodeType::ToNode(NextWord);
+                    }
+
+                    // Otherwise descend...
+                    else
+                        break;
+                }
+            }
+
+            // The next node is the key's, if it's present at all...
+            if(NextNode && !m_LessThanComparison(Key, NextNode->GetKey()))
+                return NextNode;
+            else
+                return nullptr;
+        }
+
+        // Select a random level. Useful when creating a new node. Each thread
+        //  draws from its own generator...
+        static int GetRandomLevel() noexcept
+        {
+            return SkipListThreadLevelGenerator<MaximumLevels>::GetRandomLevel();
+        }
+
+        // Retire the given node, which is no longer reachable, so that it is
+        //  destroyed once no thread could still refer to it...
+        void Retire(NodeType * const Node)
+        {
+            m_Domain.Retire(Node, [](void * const Object) noexcept
+            {
+                DestroyNode(static_cast<NodeType *>(Object));
+            });
+        }
+
+        // Find the nodes on the left and right of where the given key belongs
+        //  on every level in use, physically unlinking any marked nodes passed over
+        //  along the way. Return whether the right node on the bottom level
+        //  has the key. The caller must have the domain pinned...
+        bool Seek(
+            const KeyType &Key,
+            typename NodeType::NodePointersType &Predecessors,
+            typename NodeType::NodePointersType &Successors)
+        {
+        Retry:
+
+            // Start with the header node...
+            NodeType *CurrentNode = m_Header;
+
+            // Examine each level, from the highest level to the lowest...
+            NodeType *NextNode = nullptr;
+            for(int CurrentLevel = m_HighestLevel.load(std::memory_order_seq_cst);
+                CurrentLevel >= 0;
+                --CurrentLevel)
+            {
+                // Keep moving right on this level as far as we can without
+                //  overshooting the key...
+                NextNode = CurrentNode->GetForwardPointer(CurrentLevel);
+                while(NextNode)
+                {
+                    // If the next node is marked on this level, unlink it. If
+                    //  our node changed in the meantime, start over...
+                    const std::uintptr_t NextWord = NextNode->LoadForwardWord(CurrentLevel);
+                    if(NodeType::IsMarkedWord(NextWord))
+                    {
+                        if(!CurrentNode->CompareExchangeForwardPointer(
+                            CurrentLevel, NextNode, NodeType::ToNode(NextWord)))
+                            goto Retry;
+                        NextNode = NodeType::ToNode(NextWord);
+                    }
+
+                    // Advance if it doesn't overshoot...
+                    else if(m_LessThanComparison(NextNode->GetKey(), Key))
+                    {
+                        CurrentNode = NextNode;
+                        NextNode    = NodeType::ToNode(NextWord);
+                    }
+
+                    // Otherwise descend...
+                    else
+                        break;
+                }
+
+                // Remember the nodes on either side on this level...
+                Predecessors[CurrentLevel]  = CurrentNode;
+                Successors[CurrentLevel]    = NextNode;
+            }
+
+            // Check whether the bottom level's right node has the key...
+            return NextNode && !m_LessThanComparison(Key, NextNode->GetKey());
+        }
+
+    // Protected attributes...
+    protected:
+
+        // Header node...
+        NodeType * const                m_Header;
+
+        // Highest level any node has been linked into, which never decreases.
+        //  Searches begin here rather than at the top of the header...
+        std::atomic<int>                m_HighestLevel;
+
+        // Less than comparison operator...
+        LessThanComparisonType          m_LessThanComparison;
+
+        // Epoch domain used to reclaim nodes...
+        SkipListEpochDomain            &m_Domain;
+
+        // Total number of elements...
+        std::atomic<size_type>          m_Size;
+};
+
+
+// Lazy concurrent skip list, following Herlihy, Lev, Luchangco, and Shavit.
+//  It's a simpler alternative to ConcurrentSkipList for keys and values that
+//  are too large or costly to copy to suit a lock-free node. Insert() and
+//  Delete() find the nodes either side of the key without locking, then lock
+//  only those predecessors, validate that nothing changed, and splice. Each
+//  node carries a flag marking it as deleted and another set once it has been
+//  linked into every level. Search() never locks or writes, and a key is
+//  present if its node is fully linked and unmarked. Deleted nodes are
+//  reclaimed through the same epoch domain as ConcurrentSkipList, and as with
+//  it an existing key's value is never updated by Insert()...
+template
+<
+    typename    KeyType,                                                        /* Key type */
+    typename    ValueType,                                                      /* Value type associated with key */
+    typename    LessThanComparisonType = decltype(std::less<KeyType>()),        /* How to compare keys to each other */
+    int         MaximumLevels = 16                                              /* Maximum number of levels, each indexed from [0, MaximumLevel) */
+>
+class LazySkipList
+{
+    // Protected forward declarations...
+    protected:
+
+        // Node type will be defined later...
+        class NodeType;
+
+    // Public types...
+    public:
+
+        // Key-value type...
+        using KeyValueType      = std::pair<const KeyType, ValueType>;
+
+        // Type alias for how we count elements...
+        using size_type         = std::size_t;
+
+    // Public methods...
+    public:
+
+        // Constructor...
+        explicit LazySkipList(
+            const LessThanComparisonType &LessThanCompare = LessThanComparisonType())
+          : m_Header(CreateNode(MaximumLevels)),
+            m_HighestLevel(0),
+            m_LessThanComparison(LessThanCompare),
+            m_Domain(SkipListEpochDomain::GetInstance()),
+            m_Size(0)
+        {
+            // The header is never deleted and is always fully linked...
+            m_Header->SetFullyLinked();
+        }
+
+        // Nodes are owned by exactly one list...
+        LazySkipList(const LazySkipList &) = delete;
+        LazySkipList &operator=(const LazySkipList &) = delete;
+
+        // Check whether the given key exists...
+        bool Contains(const KeyType &Key) const
+        {
+            // Keep anything we find from being reclaimed while we look...
+            const SkipListEpochDomain::GuardType Guard(m_Domain);
+            return FindNode(Key) != nullptr;
+        }
+
+        // Delete the given key and its associated value if the key exists.
+        //  Return number of deleted elements, which should be either zero or
+        //  one...
+        size_type Delete(const KeyType &Key)
+        {
+            // Keep anything we find from being reclaimed while we look...
+            const SkipListEpochDomain::GuardType Guard(m_Domain);
+
+            // Nodes on the left and right of the key on each level...
+            typename NodeType::NodePointersType Predecessors;
+            typename NodeType::NodePointersType Successors;
+
+            // Node we are deleting, once we've marked it...
+            NodeType *Victim = nullptr;
+
+            while(true)
+            {
+                // Find the key, and the highest level its node is on...
+                const int FoundLevel = Seek(Key, Predecessors, Successors);
+
+                // If we haven't claimed a node yet, we can only delete one
+                //  that's fully linked, unmarked, and found on its top level,
+                //  since otherwise it's still being inserted or deleted...
+                if(!Victim)
+                {
+                    if(FoundLevel < 0)
+                        return 0;
+                    NodeType * const Candidate = Successors[FoundLevel];
+                    if(!Candidate->IsFullyLinked() ||
+                       (Candidate->GetLevel() - 1 != FoundLevel) ||
+                       Candidate->IsMarked())
+                        return 0;
+
+                    // Claim it by marking it under its lock. If another thread
+                    //  marked it first, then it deleted the key...
+                    Candidate->Lock();
+                    if(Candidate->IsMarked())
+                    {
+                        Candidate->Unlock();
+                        return 0;
+                    }
+                    Candidate->SetMarked();
+                    Victim = Candidate;
+                }
+
+                // Lock each predecessor and check it still precedes the victim
+                //  and hasn't been deleted itself...
+                const int TopLevel = Victim->GetLevel() - 1;
+                int HighestLocked = -1;
+                bool Valid = true;
+                for(int CurrentLevel = 0; Valid && (CurrentLevel <= TopLevel); ++CurrentLevel)
+                {
+                    NodeType * const Predecessor = Predecessors[CurrentLevel];
+                    if((CurrentLevel == 0) || (Predecessor != Predecessors[CurrentLevel - 1]))
+                        Predecessor->Lock();
+                    HighestLocked = CurrentLevel;
+                    Valid = !Predecessor->IsMarked() &&
+                            (Predecessor->GetForwardPointer(CurrentLevel) == Victim);
+                }
+
+                // Something changed, so unlock and search again...
+                if(!Valid)
+                {
+                    UnlockPredecessors(Predecessors, HighestLocked);
+                    continue;
+                }
+
+                // Splice the victim out of each level, top down...
+                for(int CurrentLevel = TopLevel; CurrentLevel >= 0; --CurrentLevel)
+                    Predecessors[CurrentLevel]->SetForwardPointer(
+                        CurrentLevel, Victim->GetForwardPointer(CurrentLevel));
+
+                // It's now unreachable and can't be linked to again, since
+                //  inserters check their successors aren't marked...
+                Victim->Unlock();
+                UnlockPredecessors(Predecessors, HighestLocked);
+
+                // Update the number of elements and reclaim the victim...
+                m_Size.fetch_sub(1, std::memory_order_relaxed);
+                Retire(Victim);
+
+                // Signal to user deletion of a single element...
+                return 1;
+            }
+        }
+
+        // Get the number of elements. While other threads are modifying the
+        //  list, this is only a snapshot...
+        size_type GetSize() const noexcept { return m_Size.load(std::memory_order_relaxed); }
+
+        // Insert the given key and value if the key does not exist, returning
+        //  true. Otherwise leave the existing value untouched and return
+        //  false...
+        bool Insert(KeyType Key, ValueType Value)
+        {
+            // Keep anything we find from being reclaimed while we look...
+            const SkipListEpochDomain::GuardType Guard(m_Domain);
+
+            // Level the new node will have...
+            const int NewLevel = GetRandomLevel();
+
+            // Raise the highest level in use to the new node's before
+            //  searching, so the search finds its neighbours on every level it
+            //  will be linked into...
+            int HighestLevel = m_HighestLevel.load(std::memory_order_seq_cst);
+            while((HighestLevel < NewLevel) &&
+                  !m_HighestLevel.compare_exchange_weak(HighestLevel, NewLevel, std::memory_order_seq_cst))
+                ;
+
+            // New node, once we've created it...
+            NodeType *NewNode = nullptr;
+
+            // Nodes on the left and right of the key on each level...
+            typename NodeType::NodePointersType Predecessors;
+            typename NodeType::NodePointersType Successors;
+
+            while(true)
+            {
+                // Find where the key belongs. Once the key has been moved into
+                //  the new node, search by the node's copy...
+                const KeyType &SearchKey = NewNode ? NewNode->GetKey() : Key;
+                const int FoundLevel = Seek(SearchKey, Predecessors, Successors);
+
+                // If the key already exists and isn't being deleted, wait for
+                //  its insertion to finish and then we're done, discarding any
+                //  node we created that was never linked. If it's being
+                //  deleted, search again...
+                if(FoundLevel >= 0)
+                {
+                    const NodeType * const FoundNode = Successors[FoundLevel];
+                    if(FoundNode->IsMarked())
+                        continue;
+                    while(!FoundNode->IsFullyLinked())
+                        std::this_thread::yield();
+                    if(NewNode)
+                        DestroyNode(NewNode);
+                    return false;
+                }
+
+                // Create the new node outside of any lock, moving the key and
+                //  value into it, if we haven't already...
+                if(!NewNode)
+                    NewNode = CreateNode(NewLevel + 1, std::move(Key), std::move(Value));
+
+                // Lock each predecessor and check that it and its successor
+                //  are still adjacent and neither has been deleted...
+                int HighestLocked = -1;
+                bool Valid = true;
+                for(int CurrentLevel = 0; Valid && (CurrentLevel <= NewLevel); ++CurrentLevel)
+                {
+                    NodeType * const Predecessor    = Predecessors[CurrentLevel];
+                    NodeType * const Successor      = Successors[CurrentLevel];
+                    if((CurrentLevel == 0) || (Predecessor != Predecessors[CurrentLevel - 1]))
+                        Predecessor->Lock();
+                    HighestLocked = CurrentLevel;
+                    Valid = !Predecessor->IsMarked() &&
+                            (!Successor || !Successor->IsMarked()) &&
+                            (Predecessor->GetForwardPointer(CurrentLevel) == Successor);
+                }
+
+                // Something changed, so unlock and search again...
+                if(!Valid)
+                {
+                    UnlockPredecessors(Predecessors, HighestLocked);
+                    continue;
+                }
+
+                // Splice the new node into each level, bottom up...
+                for(int CurrentLevel = 0; CurrentLevel <= NewLevel; ++CurrentLevel)
+                    NewNode->SetForwardPointer(CurrentLevel, Successors[CurrentLevel]);
+                for(int CurrentLevel = 0; CurrentLevel <= NewLevel; ++CurrentLevel)
+                    Predecessors[CurrentLevel]->SetForwardPointer(CurrentLevel, NewNode);
+
+                // It's now part of the list...
+                NewNode->SetFullyLinked();
+                UnlockPredecessors(Predecessors, HighestLocked);
+
+                // Update the number of elements and signal the key was
+                //  inserted...
+                m_Size.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        // Search for the given key, returning a copy of its value if found...
+        std::optional<ValueType> Search(const KeyType &Key) const
+        {
+            // Keep anything we find from being reclaimed while we copy it...
+            const SkipListEpochDomain::GuardType Guard(m_Domain);
+
+            // Copy the value if we found it...
+            if(const NodeType * const Node = FindNode(Key))
+                return Node->GetValue();
+            else
+                return std::nullopt;
+        }
+
+        // Search for the given key, calling the visitor with its key and value
+        //  pair if found rather than copying the value out. The pair is only
+        //  valid during the call. Return whether it was found...
+        template <typename VisitorType>
+        bool Search(const KeyType &Key, VisitorType &&Visitor) const
+        {
+            // Keep anything we find from being reclaimed while it's visited...
+            const SkipListEpochDomain::GuardType Guard(m_Domain);
+
+            // Visit it if we found it...
+            const NodeType * const Node = FindNode(Key);
+            if(Node)
+                Visitor(Node->GetKeyValue());
+            return Node != nullptr;
+        }
+
+        // Destructor. No other thread may be using the list by now...
+       ~LazySkipList()
+        {
+            // Every node still linked is ours to destroy. Any that were
+            //  unlinked have been retired already...
+            NodeType *CurrentNode = m_Header;
+            while(CurrentNode)
+            {
+                NodeType * const NextNode = CurrentNode->GetForwardPointer(0);
+                DestroyNode(CurrentNode);
+                CurrentNode = NextNode;
+            }
+        }
+
+    // Protected types...
+    protected:
+
+        // Node type. As with SkipList, each node and its tower of forward
+        //  pointers live in a single allocation sized to the node's own
+        //  height...
+        class alignas(KeyValueType) alignas(std::atomic<void *>) NodeType
+        {
+            // Public types...
+            public:
+
+                // Node pointers large enough to track one node for every
+                //  possible level, such as during a search...
+                using NodePointersType = std::array<NodeType *, MaximumLevels>;
+
+            // Public methods...
+            public:
+
+                // Construct by height, with the key and value pair constructed
+                //  in place from the remaining arguments, or default
+                //  initialized if there are none...
+                template <typename... ArgumentTypes>
+                explicit NodeType(const int Height, ArgumentTypes &&... Arguments)
+                  : m_KeyValue(std::forward<ArgumentTypes>(Arguments)...),
+                    m_Height(Height),
+                    m_FullyLinked(false),
+                    m_Locked(false),
+                    m_Marked(false)
+                {
+                    // Start with every forward pointer in the tower null...
+                    for(int CurrentLevel = 0; CurrentLevel < m_Height; ++CurrentLevel)
+                        new(GetForwardPointers() + CurrentLevel) std::atomic<NodeType *>(nullptr);
+                }
+
+                // Nodes are always created in place within storage large
+                //  enough for their tower, so they can never be copied...
+                NodeType(const NodeType &) = delete;
+                NodeType &operator=(const NodeType &) = delete;
+
+                // Calculate the number of bytes needed to store a node with
+                //  the given height, including its tower...
+                static constexpr std::size_t GetAllocationSize(const int Height) noexcept
+                {
+                    return sizeof(NodeType) +
+                        (static_cast<std::size_t>(Height) * sizeof(std::atomic<NodeType *>));
+                }
+
+                // Get the given level's forward pointer...
+                NodeType *GetForwardPointer(const int Level) const noexcept
+                {
+                    assert(Level < m_Height);
+                    return GetForwardPointers()[Level].load(std::memory_order_acquire);
+                }
+
+                // Get the key...
+                const KeyType &GetKey() const noexcept { return m_KeyValue.first; }
+
+                // Get the key and value pair...
+                const KeyValueType &GetKeyValue() const noexcept { return m_KeyValue; }
+
+                // Get the level, or the number of levels in the list this node
+                //  participates in and hence the height of its tower...
+                int GetLevel() const noexcept { return m_Height; }
+
+                // Get the value...
+                const ValueType &GetValue() const noexcept { return m_KeyValue.second; }
+
+                // Check whether the node has been linked into every level...
+                bool IsFullyLinked() const noexcept { return m_FullyLinked.load(std::memory_order_acquire); }
+
+                // Check whether the node has been deleted...
+                bool IsMarked() const noexcept { return m_Marked.load(std::memory_order_acquire); }
+
+                // Acquire the node's lock, yielding while another thread has
+                //  it...
+                void Lock() noexcept
+                {
+                    while(m_Locked.exchange(true, std::memory_order_acquire))
+                    {
+                        while(m_Locked.load(std::memory_order_relaxed))
+                            std::this_thread::yield();
+                    }
+                }
+
+                // Set the given level's forward pointer...
+                void SetForwardPointer(const int Level, NodeType * const Node) noexcept
+                {
+                    assert(Level < m_Height);
+                    GetForwardPointers()[Level].store(Node, std::memory_order_release);
+                }
+
+                // Flag the node as linked into every level...
+                void SetFullyLinked() noexcept { m_FullyLinked.store(true, std::memory_order_release); }
+
+                // Flag the node as deleted...
+                void SetMarked() noexcept { m_Marked.store(true, std::memory_order_release); }
+
+                // Release the node's lock...
+                void Unlock() noexcept { m_Locked.store(false, std::memory_order_release); }
+
+            // Protected methods...
+            protected:
+
+                // Get the start of the tower which begins immediately after
+                //  the node object itself...
+                std::atomic<NodeType *> *GetForwardPointers() const noexcept
+                {
+                    return reinterpret_cast<std::atomic<NodeType *> *>(
+                        const_cast<std::byte *>(reinterpret_cast<const std::byte *>(this)) + sizeof(NodeType));
+                }
+
+            // Protected attributes...
+            protected:
+
+                // Key and value pair...
+                KeyValueType        m_KeyValue;
+
+                // Number of forward pointers in the tower following us...
+                int                 m_Height;
+
+                // Whether the node has been linked into every level...
+                std::atomic<bool>   m_FullyLinked;
+
+                // Whether a thread holds the node's lock...
+                std::atomic<bool>   m_Locked;
+
+                // Whether the node has been deleted...
+                std::atomic<bool>   m_Marked;
+        };
+
+    // Protected methods...
+    protected:
+
+        // Allocate and construct a node of the given height, forwarding the
+        //  remaining arguments to its constructor...
+        template <typename... ArgumentTypes>
+        static NodeType *CreateNode(const int Height, ArgumentTypes &&... Arguments)
+        {
+            // Allocate storage for the node and its tower together...
+            void * const Storage = ::operator new(NodeType::GetAllocationSize(Height));
+
+            // Construct the node in place, releasing the storage if the key or
+            //  value threw during construction...
+            try
+            {
+                return new(Storage) NodeType(
+                    Height, std::forward<ArgumentTypes>(Arguments)...);
+            }
+            catch(...)
+            {
+                ::operator delete(Storage);
+                throw;
+            }
+        }
+
+        // Destroy and de-allocate the given node...
+        static void DestroyNode(NodeType * const Node) noexcept
+        {
+            Node->~NodeType();
+            ::operator delete(Node);
+        }
+
+        // Find the node with the given key if it's fully linked and not
+        //  deleted, or return null. The caller must have the domain pinned...
+        const NodeType *FindNode(const KeyType &Key) const
+        {
+            // Start with the header node...
+            const NodeType *CurrentNode = m_Header;
+
+            // Examine each level, from the highest level to the lowest...
+            const NodeType *NextNode = nullptr;
+            for(int CurrentLevel = m_HighestLevel.load(std::memory_order_seq_cst);
+                CurrentLevel >= 0;
+                --CurrentLevel)
+            {
+                // Keep moving right on this level as far as we can without
+                //  overshooting the key...
+                NextNode = CurrentNode->GetForwardPointer(CurrentLevel);
+                while(NextNode && m_LessThanComparison(NextNode->GetKey(), Key))
+                {
+                    CurrentNode = NextNode;
+                    NextNode    = CurrentNode->GetForwardPointer(CurrentLevel);
+                }
+            }
+
+            // The next node is the key's, if it's present at all...
+            if(NextNode && !m_LessThanComparison(Key, NextNode->GetKey()) &&
+               NextNode->IsFullyLinked() && !NextNode->IsMarked())
+                return NextNode;
+            else
+                return nullptr;
+        }
+
+        // Select a random level. Useful when creating a new node. Each thread
+        //  draws from its own generator...
+        static int GetRandomLevel() noexcept
+        {
+            return SkipListThreadLevelGenerator<MaximumLevels>::GetRandomLevel();
+        }
+
+        // Retire the given node, which is no longer reachable, so that it is
+        //  destroyed once no thread could still refer to it...
+        void Retire(NodeType * const Node)
+        {
+            m_Domain.Retire(Node, [](void * const Object) noexcept
+            {
+                DestroyNode(static_cast<NodeType *>(Object));
+            });
+        }
+
+        // Find the nodes on the left and right of where the given key belongs
+        //  on every level in use without locking. Return the highest level
+        //  the key's node was found on, or -1 if it wasn't. The caller must
+        //  have the domain pinned...
+        int Seek(
+            const KeyType &Key,
+            typename NodeType::NodePointersType &Predecessors,
+            typename NodeType::NodePointersType &Successors) const
+        {
+            // Highest level the key was found on...
+            int FoundLevel = -1;
+
+            // Start with the header node...
+            NodeType *CurrentNode = m_Header;
+
+            // Examine each level, from the highest level to the lowest...
+            for(int CurrentLevel = m_HighestLevel.load(std::memory_order_seq_cst);
+                CurrentLevel >= 0;
+                --CurrentLevel)
+            {
+                // Keep moving right on this level as far as we can without
+                //  overshooting the key...
+                NodeType *NextNode = CurrentNode->GetForwardPointer(CurrentLevel);
+                while(NextNode && m_LessThanComparison(NextNode->GetKey(), Key))
+                {
+                    CurrentNode = NextNode;
+                    NextNode    = CurrentNode->GetForwardPointer(CurrentLevel);
+                }
+
+                // Note the first level we find the key on...
+                if((FoundLevel < 0) && NextNode && !m_LessThanComparison(Key, NextNode->GetKey()))
+                    FoundLevel = CurrentLevel;
+
+                // Remember the nodes on either side on this level...
+                Predecessors[CurrentLevel]  = CurrentNode;
+                Successors[CurrentLevel]    = NextNode;
+            }
+
+            // Return where we found the key, if anywhere...
+            return FoundLevel;
+        }
+
+        // Unlock each distinct predecessor locked on levels up to and
+        //  including the given one...
+        static void UnlockPredecessors(
+            const typename NodeType::NodePointersType &Predecessors,
+            const int HighestLocked) noexcept
+        {
+            for(int CurrentLevel = 0; CurrentLevel <= HighestLocked; ++CurrentLevel)
+            {
+                if((CurrentLevel == 0) || (Predecessors[CurrentLevel] != Predecessors[CurrentLevel - 1]))
+                    Predecessors[CurrentLevel]->Unlock();
+            }
+        }
+
+    // Protected attributes...
+    protected:
+
+        // Header node...
+        NodeType * const                m_Header;
+
+        // Highest level any node has been linked into, which never decreases.
+        //  Searches begin here rather than at the top of the header...
+        std::atomic<int>                m_HighestLevel;
+
+        // Less than comparison operator...
+        LessThanComparisonType          m_LessThanComparison;
+
+        // Epoch domain used to reclaim nodes...
+        SkipListEpochDomain            &m_Domain;
+
+        // Total number of elements...
+        std::atomic<size_type>          m_Size;
+};
+
+// Multiple include protection...
+#endif
@@ -0,0 +1,629 @@
+/*
+    Copyright (C) 2024-2025 Cartesian Theatre. All rights reserved.
+*/
+
+// Multiple include protection...
+#ifndef _MAPPED_SKIP_LIST_H_
+#define _MAPPED_SKIP_LIST_H_
+
+// Includes...
+
+    // Standard C++ / POSIX system headers...
+    #include <algorithm>
+    #include <cassert>
+    #include <cerrno>
+    #include <cstddef>
+    #include <cstdint>
+    #include <cstdio>
+    #include <cstring>
+    #include <fstream>
+    #include <functional>
+    #include <iterator>
+    #include <stdexcept>
+    #include <string>
+    #include <system_error>
+    #include <type_traits>
+    #include <utility>
+    #include <vector>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+
+    // Our headers...
+    #include "UnrolledSkipList.h"
+
+// Header at the start of a skip list snapshot. A snapshot holds every key in
+//  order in one contiguous array, then every value in another, followed by
+//  the levels of an index above the keys. Each entry on an index level is the
+//  first key of a run of fanout entries on the level below, so the entry at
+//  each index samples the level below at that index times the fanout and its
+//  position needn't be stored. The top level holds no more than fanout
+//  entries. Every array begins on a multiple of the section alignment
+//  from the start of the file. Keys, values, and counts are stored in the
+//  native byte order and layout, so a snapshot can only be opened on the same
+//  platform, with the same key and value types, as it was saved...
+struct SkipListSnapshotHeader
+{
+    // Identifies a skip list snapshot...
+    static constexpr char Signature[8] = {'S', 'K', 'I', 'P', 'L', 'I', 'S', 'T'};
+
+    // Version of the layout described here...
+    static constexpr std::uint32_t CurrentVersion = 2;
+
+    // Most index levels a snapshot can have, enough for fanout to the power
+    //  of this many keys...
+    static constexpr std::size_t MaximumLevels = 16;
+
+    // Entries on each index level for every one on the level above, unless
+    //  saved with another...
+    static constexpr std::size_t DefaultFanout = 16;
+
+    // Every array begins on a multiple of this many bytes, which is also the
+    //  most any key or value type may be aligned to...
+    static constexpr std::size_t SectionAlignment = 64;
+
+    // Round the given offset up to the start of the next section...
+    static constexpr std::uint64_t AlignSection(const std::uint64_t Offset) noexcept
+    {
+        return (Offset + SectionAlignment - 1) & ~std::uint64_t(SectionAlignment - 1);
+    }
+
+    // Where to find each index level...
+    struct LevelType
+    {
+        // Entries on the level...
+        std::uint64_t   m_Count;
+
+        // Offset from the start of the file of the array of their keys...
+        std::uint64_t   m_KeysOffset;
+    };
+
+    // Signature, as above...
+    char                m_Signature[8];
+
+    // Version of the layout...
+    std::uint32_t       m_Version;
+
+    // Number of index levels above the keys...
+    std::uint32_t       m_LevelCount;
+
+    // Size of each key and value...
+    std::uint64_t       m_KeySize;
+    std::uint64_t       m_ValueSize;
+
+    // Number of key value pairs...
+    std::uint64_t       m_Count;
+
+    // Entries on each index level for every one on the level above...
+    std::uint64_t       m_Fanout;
+
+    // Offsets from the start of the file of the arrays of keys and values...
+    std::uint64_t       m_KeysOffset;
+    std::uint64_t       m_ValuesOffset;
+
+    // Total size of the file...
+    std::uint64_t       m_FileSize;
+
+    // Index levels, beginning with the one directly above the keys...
+    LevelType           m_Levels[MaximumLevels];
+};
+
+// Save every key value pair in the given list, in order, to a snapshot at the
+//  given path that MappedSkipList can open without reading it in. Any list
+//  whose iterators visit pairs in key order will do, including SkipList and
+//  UnrolledSkipList, so long as its keys and values are trivially copyable.
+//  The snapshot is written beside the path first and then renamed over it, so
+//  an existing snapshot is only ever replaced by a complete one. Throws
+//  std::system_error if writing fails...
+template <typename ListType>
+void SaveSnapshot(
+    const ListType &List,
+    const std::string &Path,
+    const std::size_t Fanout = SkipListSnapshotHeader::DefaultFanout)
+{
+    // Key and value types stored...
+    using KeyType   = std::remove_cv_t<std::remove_reference_t<decltype(List.begin()->first)>>;
+    using ValueType = std::remove_cv_t<std::remove_reference_t<decltype(List.begin()->second)>>;
+    static_assert(std::is_trivially_copyable_v<KeyType> && std::is_trivially_copyable_v<ValueType>,
+                  "Only trivially copyable keys and values can be saved to a snapshot.");
+    static_assert(alignof(KeyType) <= SkipListSnapshotHeader::SectionAlignment &&
+                  alignof(ValueType) <= SkipListSnapshotHeader::SectionAlignment,
+                  "Keys and values cannot be aligned beyond a snapshot's sections.");
+    assert(Fanout >= 2);
+
+    // Sample every fanout'th key for the first index level, and every
+    //  fanout'th entry of each level for the next, until one is small enough
+    //  to search from the top...
+    std::vector<std::vector<KeyType>> LevelKeys;
+    std::size_t BelowCount = List.GetSize();
+    while(BelowCount > Fanout)
+    {
+        // Too many keys for the levels we can describe...
+        if(LevelKeys.size() == SkipListSnapshotHeader::MaximumLevels)
+            throw std::length_error("Too many keys for a snapshot with this fanout.");
+
+        // Sample the level below...
+        std::vector<KeyType> Keys;
+        Keys.reserve((BelowCount + Fanout - 1) / Fanout);
+        if(LevelKeys.empty())
+        {
+            std::size_t Index = 0;
+            for(const auto &KeyValue : List)
+            {
+                if(Index++ % Fanout == 0)
+                    Keys.push_back(KeyValue.first);
+            }
+        }
+        else
+        {
+            for(std::size_t Index = 0; Index < BelowCount; Index += Fanout)
+                Keys.push_back(LevelKeys.back()[Index]);
+        }
+        LevelKeys.push_back(std::move(Keys));
+        BelowCount = LevelKeys.back().size();
+    }
+
+    // Lay out each array...
+    SkipListSnapshotHeader Header{};
+    std::copy(std::begin(Header.Signature), std::end(Header.Signature), Header.m_Signature);
+    Header.m_Version        = SkipListSnapshotHeader::CurrentVersion;
+    Header.m_LevelCount     = static_cast<std::uint32_t>(LevelKeys.size());
+    Header.m_KeySize        = sizeof(KeyType);
+    Header.m_ValueSize      = sizeof(ValueType);
+    Header.m_Count          = List.GetSize();
+    Header.m_Fanout         = Fanout;
+    Header.m_KeysOffset     = SkipListSnapshotHeader::AlignSection(sizeof(Header));
+    Header.m_ValuesOffset   = SkipListSnapshotHeader::AlignSection(
+        Header.m_KeysOffset + (Header.m_Count * sizeof(KeyType)));
+    std::uint64_t Offset    = Header.m_ValuesOffset + (Header.m_Count * sizeof(ValueType));
+    for(std::size_t Level = 0; Level < LevelKeys.size(); ++Level)
+    {
+        SkipListSnapshotHeader::LevelType &Section = Header.m_Levels[Level];
+        Section.m_Count             = LevelKeys[Level].size();
+        Section.m_KeysOffset        = SkipListSnapshotHeader::AlignSection(Offset);
+        Offset = Section.m_KeysOffset + (Section.m_Count * sizeof(KeyType));
+    }
+    Header.m_FileSize = Offset;
+
+    // Write to a file beside the one to replace...
+    const std::string TemporaryPath = Path + ".partial";
+    std::ofstream File(TemporaryPath, std::ios::binary | std::ios::trunc);
+    if(!File)
+        throw std::system_error(errno, std::generic_category(), "Cannot create " + TemporaryPath);
+
+    // Write the given bytes, then pad up to the given offset...
+    std::uint64_t Written = 0;
+    auto Write = [&](const void * const Bytes, const std::size_t Size)
+    {
+        File.write(static_cast<const char *>(Bytes), static_cast<std::streamsize>(Size));
+        Written += Size;
+    };
+    auto PadTo = [&](const std::uint64_t NextOffset)
+    {
+        assert(NextOffset >= Written);
+        static constexpr char Padding[SkipListSnapshotHeader::SectionAlignment] = {};
+        Write(Padding, static_cast<std::size_t>(NextOffset - Written));
+    };
+
+    // Write the header, the keys, and the values...
+    Write(&Header, sizeof(Header));
+    PadTo(Header.m_KeysOffset);
+    for(const auto &KeyValue : List)
+        Write(&KeyValue.first, sizeof(KeyType));
+    PadTo(Header.m_ValuesOffset);
+    for(const auto &KeyValue : List)
+        Write(&KeyValue.second, sizeof(ValueType));
+
+    // Write each index level's keys...
+    for(std::size_t Level = 0; Level < LevelKeys.size(); ++Level)
+    {
+        PadTo(Header.m_Levels[Level].m_KeysOffset);
+        Write(LevelKeys[Level].data(), LevelKeys[Level].size() * sizeof(KeyType));
+    }
+    assert(Written == Header.m_FileSize);
+
+    // Make sure it all reached the file before it replaces the old one...
+    File.close();
+    if(!File)
+    {
+        const int Error = errno;
+        std::remove(TemporaryPath.c_str());
+        throw std::system_error(Error, std::generic_category(), "Cannot write " + TemporaryPath);
+    }
+    if(std::rename(TemporaryPath.c_str(), Path.c_str()) != 0)
+    {
+        const int Error = errno;
+        std::remove(TemporaryPath.c_str());
+        throw std::system_error(Error, std::generic_category(), "Cannot replace " + Path);
+    }
+}
+
+// Read only view of a snapshot saved by SaveSnapshot(), mapped into memory
+//  rather than read in. Searches descend the snapshot's index levels straight
+//  from the page cache, scanning at most one run of fanout keys on each, and
+//  nothing is deserialised. Keys are compared, vectorised where possible, as
+//  within an UnrolledSkipList's blocks. To modify the pairs, build a SkipList
+//  from the view's iterators with SkipListFromSortedRange, which bulk loads
+//  them without any searches...
+template
+<
+    typename    KeyType,                                                        /* Key type */
+    typename    ValueType,                                                      /* Value type associated with key */
+    typename    LessThanComparisonType = decltype(std::less<KeyType>())         /* How the keys were ordered when saved */
+>
+class MappedSkipList
+{
+    // Check invariants...
+    static_assert(std::is_trivially_copyable_v<KeyType> && std::is_trivially_copyable_v<ValueType>,
+                  "Only trivially copyable keys and values can be mapped from a snapshot.");
+
+    // Public types...
+    public:
+
+        // Keys and values are stored apart, so dereferencing an iterator
+        //  yields a pair of references to them rather than a reference to a
+        //  pair...
+        using ReferenceType     = std::pair<const KeyType &, const ValueType &>;
+
+        // Type alias for how we count elements...
+        using size_type         = std::size_t;
+
+        // Custom iterator that iterates across the mapped keys in order...
+        class IteratorType
+        {
+            // Public traits...
+            public:
+
+                // Signed integer that can be used to identify distance
+                //  between iterators...
+                using difference_type   = std::ptrdiff_t;
+
+                // Category iterator belongs to...
+                using iterator_category = std::forward_iterator_tag;
+
+                // Type of object when iterator is dereferenced...
+                using value_type        = std::pair<KeyType, ValueType>;
+
+                // Type of reference to the type iterated over...
+                using reference         = ReferenceType;
+
+                // Access operator's result, which holds the pair of
+                //  references it points to...
+                using pointer           = SkipListReferencePointer<ReferenceType>;
+
+            // Public methods...
+            public:
+
+                // Default constructor...
+                IteratorType() noexcept
+                  : m_Keys(nullptr),
+                    m_Values(nullptr),
+                    m_Index(0)
+                {
+                }
+
+                // Construct pointing to the given index within the given
+                //  arrays of keys and values...
+                IteratorType(
+                    const KeyType * const Keys,
+                    const ValueType * const Values,
+                    const size_type Index) noexcept
+                  : m_Keys(Keys),
+                    m_Values(Values),
+                    m_Index(Index)
+                {
+                }
+
+                // Dereference operator returns references to the current key
+                //  and its value...
+                reference operator*() const noexcept { return {m_Keys[m_Index], m_Values[m_Index]}; }
+
+                // Access operator...
+                pointer operator->() const noexcept { return pointer(**this); }
+
+                // Prefix increment operator...
+                IteratorType &operator++() noexcept
+                {
+                  ++m_Index;
+                    return *this;
+                }
+
+                // Postfix increment operator...
+                IteratorType operator++(int) noexcept
+                {
+                    // Return previous state, incrementing our self...
+                    return std::exchange(*this, ++IteratorType(*this));
+                }
+
+                // Inequality operator...
+                bool operator!=(const IteratorType &RightHandSide) const noexcept
+                {
+                    return !(*this == RightHandSide);
+                }
+
+                // Equality operator. The iterators are equal if they refer to
+                //  the same index within the same snapshot...
+                bool operator==(const IteratorType &RightHandSide) const noexcept
+                {
+                    return (m_Keys == RightHandSide.m_Keys) &&
+                           (m_Index == RightHandSide.m_Index);
+                }
+
+            // Protected attributes...
+            protected:
+
+                // Mapped keys and values...
+                const KeyType      *m_Keys;
+                const ValueType    *m_Values;
+
+                // Index of the current key...
+                size_type           m_Index;
+        };
+
+        // Type alias for iterator...
+        using iterator          = IteratorType;
+
+        // Type alias for const iterator...
+        using const_iterator    = iterator;
+
+    // Public methods...
+    public:
+
+        // Map the snapshot at the given path, which must have been saved with
+        //  the same key and value types, ordered by an equivalent comparison
+        //  object. Throws std::system_error if it can't be mapped, or
+        //  std::runtime_error if it isn't a valid snapshot...
+        explicit MappedSkipList(
+            const std::string &Path,
+            const LessThanComparisonType &LessThanCompare = LessThanComparisonType())
+          : m_Mapping(nullptr),
+            m_MappingSize(0),
+            m_Header(nullptr),
+            m_Keys(nullptr),
+            m_Values(nullptr),
+            m_LessThanComparison(LessThanCompare)
+        {
+            // Open the file and find its size...
+            const int Descriptor = ::open(Path.c_str(), O_RDONLY | O_CLOEXEC);
+            if(Descriptor < 0)
+                throw std::system_error(errno, std::generic_category(), "Cannot open " + Path);
+            struct stat Status;
+            if(::fstat(Descriptor, &Status) != 0)
+            {
+                const int Error = errno;
+                ::close(Descriptor);
+                throw std::system_error(Error, std::generic_category(), "Cannot examine " + Path);
+            }
+            m_MappingSize = static_cast<std::size_t>(Status.st_size);
+
+            // Map all of it. The mapping outlives the descriptor...
+            void * const Mapping = (m_MappingSize < sizeof(SkipListSnapshotHeader))
+                ? MAP_FAILED
+                : ::mmap(nullptr, m_MappingSize, PROT_READ, MAP_SHARED, Descriptor, 0);
+            const int Error = errno;
+            ::close(Descriptor);
+            if(m_MappingSize < sizeof(SkipListSnapshotHeader))
+                throw std::runtime_error(Path + " is too small to be a skip list snapshot.");
+            if(Mapping == MAP_FAILED)
+                throw std::system_error(Error, std::generic_category(), "Cannot map " + Path);
+            m_Mapping = Mapping;
+
+            // Check it's a snapshot we can read, releasing the mapping if
+            //  not...
+            m_Header = static_cast<const SkipListSnapshotHeader *>(m_Mapping);
+            if(!IsValid())
+            {
+                ::munmap(m_Mapping, m_MappingSize);
+                throw std::runtime_error(Path + " is not a compatible skip list snapshot.");
+            }
+
+            // Find the keys and values...
+            m_Keys      = GetArray<KeyType>(m_Header->m_KeysOffset);
+            m_Values    = GetArray<ValueType>(m_Header->m_ValuesOffset);
+        }
+
+        // The mapping is owned by exactly one view...
+        MappedSkipList(const MappedSkipList &) = delete;
+        MappedSkipList &operator=(const MappedSkipList &) = delete;
+
+        // Move constructor takes ownership of the other view's mapping...
+        MappedSkipList(MappedSkipList &&Other) noexcept
+          : m_Mapping(std::exchange(Other.m_Mapping, nullptr)),
+            m_MappingSize(std::exchange(Other.m_MappingSize, 0)),
+            m_Header(std::exchange(Other.m_Header, nullptr)),
+            m_Keys(std::exchange(Other.m_Keys, nullptr)),
+            m_Values(std::exchange(Other.m_Values, nullptr)),
+            m_LessThanComparison(std::move(Other.m_LessThanComparison))
+        {
+        }
+
+        // Retrieve an iterator start...
+        iterator begin() const noexcept { return iterator(m_Keys, m_Values, 0); }
+        const_iterator cbegin() const noexcept { return begin(); }
+
+        // Retrieve an iterator end...
+        iterator end() const noexcept { return iterator(m_Keys, m_Values, GetSize()); }
+        const_iterator cend() const noexcept { return end(); }
+
+        // Get the number of elements...
+        size_type GetSize() const noexcept
+        {
+            return m_Header ? static_cast<size_type>(m_Header->m_Count) : 0;
+        }
+
+        // Find the first key value pair whose key is not less than the given
+        //  key, returning the end if there isn't one...
+        iterator LowerBound(const KeyType &Key) const
+        {
+            return iterator(m_Keys, m_Values, FindIndex(Key));
+        }
+
+        // Visit every key value pair whose key is not less than the lower key
+        //  and less than the upper key, in order, without constructing any
+        //  iterators. The visitor is called with a pair of references to each
+        //  key and value, and if it returns a boolean, visiting stops when it
+        //  returns false. Return the number visited...
+        template <typename VisitorType>
+        size_type Range(
+            const KeyType &LowerKey,
+            const KeyType &UpperKey,
+            VisitorType &&Visitor) const
+        {
+            // Visit from the lower bound until a key reaches the upper key...
+            size_type Visited = 0;
+            for(size_type Index = FindIndex(LowerKey);
+                Index < GetSize() && m_LessThanComparison(m_Keys[Index], UpperKey);
+                ++Index)
+            {
+              ++Visited;
+                if(!SkipListVisit(Visitor, ReferenceType(m_Keys[Index], m_Values[Index])))
+                    break;
+            }
+
+            // Return the number visited...
+            return Visited;
+        }
+
+        // Search for the given key, returning an iterator to its key value pair
+        //  if found, or the end if not...
+        iterator Search(const KeyType &SearchKey) const
+        {
+            const size_type Index = FindIndex(SearchKey);
+            return (Index < GetSize() && !m_LessThanComparison(SearchKey, m_Keys[Index]))
+                ? iterator(m_Keys, m_Values, Index) : end();
+        }
+
+        // Destructor...
+       ~MappedSkipList()
+        {
+            // Release the mapping, unless it was moved away...
+            if(m_Mapping)
+                ::munmap(m_Mapping, m_MappingSize);
+        }
+
+    // Protected types...
+    protected:
+
+        // How sorted arrays of keys are searched...
+        using KeySearchType = SkipListKeySearch<KeyType, LessThanComparisonType>;
+
+    // Protected methods...
+    protected:
+
+        // Find the index of the first key not less than the given key, or the
+        //  size if there isn't one. Each index level narrows the search on the
+        //  level below to the run between two of its entries...
+        size_type FindIndex(const KeyType &Key) const
+        {
+            // Nothing to search if moved from...
+            if(!m_Header)
+                return 0;
+
+            // Begin with every entry on the top level, or every key if there
+            //  are no index levels...
+            const std::size_t Fanout = static_cast<std::size_t>(m_Header->m_Fanout);
+            const std::uint32_t LevelCount = m_Header->m_LevelCount;
+            std::size_t Begin = 0;
+            std::size_t End = LevelCount
+                ? static_cast<std::size_t>(m_Header->m_Levels[LevelCount - 1].m_Count)
+                : GetSize();
+
+            // Descend. The first entry not less than the key on each level
+            //  is within the current run. Every key below the entry before it
+            //  is less, and the key below the entry itself is not. The entry
+            //  at each index is the one at fanout times it on the level below...
+            for(std::uint32_t Level = LevelCount; Level-- > 0;)
+            {
+                const SkipListSnapshotHeader::LevelType &Section = m_Header->m_Levels[Level];
+                const KeyType * const Keys = GetArray<KeyType>(Section.m_KeysOffset);
+                const std::size_t Index = Begin + KeySearchType::template CountBefore<false>(
+                    Keys + Begin, End - Begin, Key, m_LessThanComparison);
+                const std::size_t BelowCount = Level
+                    ? static_cast<std::size_t>(m_Header->m_Levels[Level - 1].m_Count)
+                    : GetSize();
+                Begin   = Index ? ((Index - 1) * Fanout) + 1 : 0;
+                End     = (Index < Section.m_Count) ? (Index * Fanout) : BelowCount;
+            }
+
+            // Search the run of keys it leaves...
+            return Begin + KeySearchType::template CountBefore<false>(
+                m_Keys + Begin, End - Begin, Key, m_LessThanComparison);
+        }
+
+        // Get the array of the given type at the given offset from the start
+        //  of the mapping...
+        template <typename ElementType>
+        const ElementType *GetArray(const std::uint64_t Offset) const noexcept
+        {
+            return reinterpret_cast<const ElementType *>(
+                static_cast<const std::byte *>(m_Mapping) + Offset);
+        }
+
+        // Check the mapping holds a snapshot we can read, with every array it
+        //  describes aligned and within it...
+        bool IsValid() const noexcept
+        {
+            // Check the header itself...
+            const SkipListSnapshotHeader &Header = *m_Header;
+            if(std::memcmp(Header.m_Signature, SkipListSnapshotHeader::Signature, sizeof(Header.m_Signature)) != 0 ||
+               Header.m_Version != SkipListSnapshotHeader::CurrentVersion ||
+               Header.m_KeySize != sizeof(KeyType) ||
+               Header.m_ValueSize != sizeof(ValueType) ||
+               Header.m_Fanout < 2 ||
+               Header.m_LevelCount > SkipListSnapshotHeader::MaximumLevels ||
+               Header.m_FileSize != m_MappingSize)
+                return false;
+
+            // Whether an array of the given number of elements of the given
+            //  size and alignment fits at the given offset...
+            auto IsWithin = [&](const std::uint64_t Offset, const std::uint64_t Count,
+                                const std::size_t Size, const std::size_t Alignment)
+            {
+                return (Offset % Alignment == 0) &&
+                       (Offset >= sizeof(SkipListSnapshotHeader)) &&
+                       (Offset <= m_MappingSize) &&
+                       (Count <= (m_MappingSize - Offset) / Size);
+            };
+
+            // Check the keys and values...
+            if(!IsWithin(Header.m_KeysOffset, Header.m_Count, sizeof(KeyType), alignof(KeyType)) ||
+               !IsWithin(Header.m_ValuesOffset, Header.m_Count, sizeof(ValueType), alignof(ValueType)))
+                return false;
+
+            // Check each index level samples the level below once per fanout
+            //  entries, so no search can stray outside it...
+            std::uint64_t BelowCount = Header.m_Count;
+            for(std::uint32_t Level = 0; Level < Header.m_LevelCount; ++Level)
+            {
+                const SkipListSnapshotHeader::LevelType &Section = Header.m_Levels[Level];
+                if(Section.m_Count == 0 ||
+                   Section.m_Count != (BelowCount + Header.m_Fanout - 1) / Header.m_Fanout ||
+                   !IsWithin(Section.m_KeysOffset, Section.m_Count, sizeof(KeyType), alignof(KeyType)))
+                    return false;
+                BelowCount = Section.m_Count;
+            }
+
+            // It's valid...
+            return true;
+        }
+
+    // Protected attributes...
+    protected:
+
+        // Start of the mapping and its size...
+        void                           *m_Mapping;
+        std::size_t                     m_MappingSize;
+
+        // Snapshot header at the start of the mapping...
+        const SkipListSnapshotHeader   *m_Header;
+
+        // Mapped keys and values...
+        const KeyType                  *m_Keys;
+        const ValueType                *m_Values;
+
+        // Comparison object...
+        LessThanComparisonType          m_LessThanComparison;
+};
+
+#endif
@@ -14,22 +14,73 @@
     #include <cassert>
     #include <cmath>
     #include <cstddef>
+    #include <cstdint>
+    #include <cstring>
+    #include <exception>
     #include <functional>
     #include <iterator>
     #include <limits>
     #include <memory>
     #include <optional>
     #include <random>
+    #include <stdexcept>
+    #include <string>
+    #include <thread>
     #include <tuple>
     #include <type_traits>
     #include <utility>
+    #include <vector>
 
-// Custom immutable forward iterator that iterates across a skip list.
-//  Prior to C++17, it was encouraged to inherit from std::iterator
-//  which would automatically populate our class with all type
-//  definitions. This is discouraged since C++17...
+// Skip list will be defined later...
+template
+<
+    typename    KeyType,
+    typename    ValueType,
+    typename    LessThanComparisonType,
+    int         MaximumLevels,
+    typename    AllocatorType,
+    typename    TraitsType
+>
+class SkipList;
+
+// Where an iterator over a skip list with back pointers keeps the list's
+//  header, so that even the end iterator can be decremented. Iterators over
+//  lists without them keep nothing...
+template <typename NodeType, bool HasBackPointer = NodeType::HasBackPointer>
+class SkipListIteratorHeader
+{
+    // Protected methods...
+    protected:
+
+        // Constructor ignores the header...
+        explicit SkipListIteratorHeader(NodeType * = nullptr) noexcept {}
+};
+template <typename NodeType>
+class SkipListIteratorHeader<NodeType, true>
+{
+    // Protected methods...
+    protected:
+
+        // Constructor...
+        explicit SkipListIteratorHeader(NodeType * const Header = nullptr) noexcept
+          : m_Header(Header)
+        {
+        }
+
+    // Protected attributes...
+    protected:
+
+        // Header of the list iterated over, whose back pointer is the tail...
+        NodeType   *m_Header;
+};
+
+// Custom immutable iterator that iterates across a skip list. It's a forward
+//  iterator, or bidirectional if the list keeps back pointers. Prior to
+//  C++17, it was encouraged to inherit from std::iterator which would
+//  automatically populate our class with all type definitions. This is
+//  discouraged since C++17...
 template <typename NodeType>
-class SkipListIterator
+class SkipListIterator : protected SkipListIteratorHeader<NodeType>
 {
     // Public traits...
     public:
@@ -44,7 +95,10 @@ class SkipListIterator
             using difference_type   = std::ptrdiff_t;
 
             // Category iterator belongs to...
-            using iterator_category = std::forward_iterator_tag;
+            using iterator_category = std::conditional_t<
+                NodeType::HasBackPointer,
+                std::bidirectional_iterator_tag,
+                std::forward_iterator_tag>;
 
             // Type of object when iterator is dereferenced...
             using value_type        = typename NodeType::value_type;
@@ -64,9 +118,11 @@ class SkipListIterator
         {
         }
 
-        // Construct pointing to the given node in the list...
-        SkipListIterator(NodeType *CurrentNode) noexcept
-          : m_CurrentNode(CurrentNode)
+        // Construct pointing to the given node in the list, given the list's
+        //  header if it keeps back pointers...
+        SkipListIterator(NodeType *CurrentNode, NodeType * const Header = nullptr) noexcept
+          : SkipListIteratorHeader<NodeType>(Header),
+            m_CurrentNode(CurrentNode)
         {
         }
 
@@ -103,6 +159,32 @@ class SkipListIterator
             return std::exchange(*this, ++*this);
         }
 
+        // Prefix decrement operator, only for lists with back pointers...
+        SkipListIterator &operator--() noexcept
+        {
+            // Check invariants...
+            static_assert(NodeType::HasBackPointer,
+                "Decrementing requires a skip list with back pointers.");
+
+            // Seek to the previous node on the bottom level. The end's
+            //  previous node is the tail, which the header points back to...
+            m_CurrentNode = m_CurrentNode
+                ? m_CurrentNode->GetBackPointer()
+                : this->m_Header->GetBackPointer();
+
+            // Return reference to updated iterator...
+            return *this;
+        }
+
+        // Postfix decrement operator, only for lists with back pointers...
+        SkipListIterator operator--(int) noexcept
+        {
+            // Return previous state, decrementing our self...
+            SkipListIterator Previous(*this);
+            --*this;
+            return Previous;
+        }
+
         // Inequality operator. This is used in for loops where the
         //  iterator is compared against the end iterator. If they are
         //  unequal, it will continue iterating...
@@ -124,586 +206,4563 @@ class SkipListIterator
     // Protected attributes...
     protected:
 
+        // The skip list may examine the node an iterator refers to...
+        template <typename, typename, typename, int, typename, typename>
+        friend class SkipList;
+
         // Current node...
         NodeType   *m_CurrentNode;
 };
 
-// Skip list is a data structure discovered by William Pugh (1989) that can be
-//  used in place of balanced trees. It uses probabilistic balancing. It works
-//  well if the elements are inserted in random order, or, unlike a binary tree,
-//  in sorted order too. It has the same asymptotic expected time bounds as a
-//  binary tree, but is simpler to implement, faster, and uses less storage...
-template
-<
-    typename    KeyType,                                                        /* Key type */
-    typename    ValueType,                                                      /* Value type associated with key */
-    typename    LessThanComparisonType = decltype(std::less<KeyType>()),        /* How to compare keys to each other */
-    int         MaximumLevels = 16                                              /* Maximum number of levels, each indexed from [0, MaximumLevel) */
->
-class SkipList
+// Node allocators hand out raw storage for skip list nodes. Because each
+//  node's tower is sized to its own level, storage is requested in bytes along
+//  with the tower height, which an allocator may use as a size class. Any
+//  allocator passed to the skip list must provide the following...
+//
+//      static constexpr bool CanDeallocateAll;
+//      void *Allocate(std::size_t Bytes, std::size_t Alignment, int Height);
+//      void Deallocate(void *Storage, std::size_t Bytes, int Height) noexcept;
+//      void DeallocateAll() noexcept;      /* Only if CanDeallocateAll */
+//      std::size_t GetReservedBytes() const noexcept;      /* Optional */
+//      void Absorb(Allocator &Other);              /* Only for Merge(), Join() */
+//      Allocator Share();                          /* Only for SplitAt() */
+//      void Transfer(Allocator &Other, std::size_t Bytes, int Height) noexcept;
+//                                                  /* Only for SplitAt() */
+//
+//  If CanDeallocateAll is true, the skip list may release every node at once
+//  without visiting them when their key and value types are trivially
+//  destructible. If GetReservedBytes() is provided, it returns the bytes the
+//  allocator currently holds from its own source, so the skip list can report
+//  how much of that its nodes aren't using. Absorb() takes over responsibility
+//  for every node the other allocator handed out, so that a list can adopt
+//  another's nodes without copying them. If the allocator is copy
+//  constructible, a copy must be able to serve as such another allocator.
+//  Share() returns a new allocator able to release any node this one has
+//  handed out, and Transfer() then hands it responsibility for one of them,
+//  along with its bytes, so that a list can give some of its nodes to another
+//  without copying them or counting them twice...
+
+// Node allocator adaptor over any std::allocator compatible allocator. Storage
+//  is requested in units of std::max_align_t so every node is suitably
+//  aligned...
+template <typename StandardAllocatorType = std::allocator<std::max_align_t>>
+class SkipListStandardAllocator
 {
-    // Protected forward declarations...
-    protected:
-
-        // Node type will be defined later...
-        class NodeType;
-
-    // Public types...
+    // Public constants...
     public:
 
-        // Key-value type...
-        using KeyValueType      = std::pair<const KeyType, ValueType>;
-
-        // Type alias for iterator...
-        using iterator          = SkipListIterator<NodeType>;
-
-        // Type alias for const iterator...
-        using const_iterator    = iterator;
-
-        // Type alias for how we count elements...
-        using size_type         = std::size_t;
+        // We cannot release all nodes without visiting each of them...
+        static constexpr bool CanDeallocateAll = false;
 
     // Public methods...
     public:
 
         // Constructor...
-        explicit SkipList(
-            const LessThanComparisonType &LessThanCompare = LessThanComparisonType())
-          : m_Header(nullptr),
-            m_End(nullptr),
-            m_HighestLevel(0),
-            m_LessThanComparison(LessThanCompare),
-            m_RandomGenerator(m_RandomDevice()),                                /* Provide a constant instead for deterministic behaviour during debugging */
-            m_Size(0)
+        explicit SkipListStandardAllocator(
+            const StandardAllocatorType &Allocator = StandardAllocatorType())
+          : m_Allocator(Allocator),
+            m_ReservedBytes(0)
         {
-            // Allocate the head node...
-            m_Header = new NodeType();
-
-            // Allocate the terminal node...
-            m_End = new NodeType();
-
-            // The head node's forward pointers all point initially to the
-            //  terminal node...
-            m_Header->SetForwardPointers(m_End);
         }
 
-        // Retrieve an iterator start...
-        iterator begin() noexcept
+        // Copies share the underlying allocator, but none of the nodes...
+        SkipListStandardAllocator(const SkipListStandardAllocator &Other)
+          : m_Allocator(Other.m_Allocator),
+            m_ReservedBytes(0)
         {
-            // Should point to either the first node after the header, which
-            //  might be the terminal node if there aren't any...
-            return iterator(m_Header->GetForwardPointer(0));
         }
 
-        // Retrieve a const iterator start...
-        const_iterator begin() const noexcept
+        // Take over the nodes the other allocator handed out, which the
+        //  underlying allocator we share can release as well as it can...
+        void Absorb(SkipListStandardAllocator &Other) noexcept
         {
-            // Should point to either the first node after the header, which
-            //  might be the terminal node if there aren't any...
-            return const_iterator(m_Header->GetForwardPointer(0));
+            assert(m_Allocator == Other.m_Allocator);
+            m_ReservedBytes += std::exchange(Other.m_ReservedBytes, 0);
         }
 
-        // Retrieve a const iterator start...
-        const_iterator cbegin() const noexcept
+        // Allocate storage for a node of the given size and height...
+        void *Allocate(
+            const std::size_t Bytes,
+            [[maybe_unused]] const std::size_t Alignment,
+            [[maybe_unused]] const int Height)
         {
-            // Should point to either the first node after the header, which
-            //  might be the terminal node if there aren't any...
-            return const_iterator(m_Header->GetForwardPointer(0));
+            assert(Alignment <= alignof(BlockType));
+            BlockType * const Storage =
+                BlockTraitsType::allocate(m_Allocator, GetBlockCount(Bytes));
+            m_ReservedBytes += GetBlockCount(Bytes) * sizeof(BlockType);
+            return Storage;
         }
 
-        // Retrieve an iterator end which is the next value after the last valid
-        //  one...
-        iterator end() noexcept
+        // Release storage previously returned by Allocate()...
+        void Deallocate(
+            void * const Storage,
+            const std::size_t Bytes,
+            [[maybe_unused]] const int Height) noexcept
         {
-            return iterator(m_End);
+            BlockTraitsType::deallocate(
+                m_Allocator, static_cast<BlockType *>(Storage), GetBlockCount(Bytes));
+            m_ReservedBytes -= GetBlockCount(Bytes) * sizeof(BlockType);
         }
 
-        // Retrieve a const iterator end which is the next value after the last
-        //  valid one...
-        const_iterator end() const noexcept
+        // Get the bytes requested from the underlying allocator for nodes
+        //  still allocated, not counting its own bookkeeping...
+        std::size_t GetReservedBytes() const noexcept { return m_ReservedBytes; }
+
+        // Get a copy, which can release any node we've handed out through
+        //  the underlying allocator we share...
+        SkipListStandardAllocator Share() const { return SkipListStandardAllocator(*this); }
+
+        // Hand responsibility for a node of the given size and height to an
+        //  allocator we're shared with...
+        void Transfer(
+            SkipListStandardAllocator &Other,
+            const std::size_t Bytes,
+            [[maybe_unused]] const int Height) noexcept
         {
-            return const_iterator(m_End);
+            m_ReservedBytes -= GetBlockCount(Bytes) * sizeof(BlockType);
+            Other.m_ReservedBytes += GetBlockCount(Bytes) * sizeof(BlockType);
         }
 
-        // Retrieve a const iterator end which is the next value after the last
-        //  valid one...
-        const_iterator cend() const noexcept
+    // Protected types...
+    protected:
+
+        // Unit of storage we request from the underlying allocator...
+        using BlockType             = std::max_align_t;
+
+        // Underlying allocator rebound to our unit of storage...
+        using BlockAllocatorType    = typename std::allocator_traits<
+            StandardAllocatorType>::template rebind_alloc<BlockType>;
+
+        // Traits for the rebound allocator...
+        using BlockTraitsType       = std::allocator_traits<BlockAllocatorType>;
+
+    // Protected methods...
+    protected:
+
+        // Calculate how many blocks are needed to store the given bytes...
+        static constexpr std::size_t GetBlockCount(const std::size_t Bytes) noexcept
         {
-            return const_iterator(m_End);
+            return (Bytes + sizeof(BlockType) - 1) / sizeof(BlockType);
         }
 
-        // Clear all elements...
-        void Clear()
-        {
-            // Track the current node we are about to delete, beginning with the
-            //  head...
-            NodeType *CurrentNode = m_Header->GetForwardPointer(0);
+    // Protected attributes...
+    protected:
 
-            // Keep walking the list until, deleting nodes, until we reach the
-            //  terminal node...
-            while(CurrentNode != m_End)
-            {
-                // Get the pointer to the next node, if any...
-                NodeType *NextNode = CurrentNode->GetForwardPointer(0);
+        // Underlying allocator...
+        BlockAllocatorType          m_Allocator;
 
-                // Delete the current node...
-                delete CurrentNode;
+        // Bytes requested for nodes still allocated...
+        std::size_t                 m_ReservedBytes;
+};
 
-                // Seek to the next one, if any...
-                CurrentNode = NextNode;
-            }
+// Size class slab node allocator. Nodes are carved sequentially out of large
+//  chunks so that nodes allocated close together in time are also close
+//  together in memory. Released nodes are kept on a free list for their tower
+//  height and are handed back out first to nodes of the same height. All
+//  chunks are released at once when the allocator is destroyed or cleared.
+//  Chunks an allocator has shared are instead kept alive for as long as any
+//  allocator sharing them is...
+template
+<
+    int         MaximumLevels,                                                  /* Tallest tower height to expect */
+    std::size_t ChunkSize = 64 * 1024                                           /* Bytes of node storage per chunk */
+>
+class SkipListPoolAllocator
+{
+    // Public constants...
+    public:
 
-            // Update the header's forward pointers to point to the terminal...
-            m_Header->SetForwardPointers(m_End);
-            
-            // Reset the highest level to only one... (we start counting at zero)
-            m_HighestLevel = 0;
+        // We can release every node in constant time per chunk...
+        static constexpr bool CanDeallocateAll = true;
 
-            // Reset the element count...
-            m_Size = 0;
-        }
+    // Public methods...
+    public:
 
-        // Delete the given key and its associated value if the key exists.
-        //  Return number of deleted elements, which should be either zero or
-        //  one...
-        size_type Delete(const KeyType &Key) noexcept
+        // Default constructor...
+        SkipListPoolAllocator() noexcept
+          : m_Chunks(nullptr),
+            m_Cursor(nullptr),
+            m_ChunkEnd(nullptr),
+            m_FreeLists{},
+            m_ReservedBytes(0),
+            m_SharedPools()
         {
-            // Vector of forward pointers to maintain that is populated after
-            //  the search is completed, but before performing the actual
-            //  splice. Each level contains the rightmost node of that level or
-            //  higher that is to the left of the location of the pending
-            //  deletion...
-            typename SkipList<KeyType, ValueType, LessThanComparisonType, MaximumLevels>::NodeType::ForwardPointersType
-                UpdatedPointers{};
+        }
 
-            // Start with the header node...
-            NodeType *CurrentNode = m_Header;
+        // Chunks are owned by exactly one allocator...
+        SkipListPoolAllocator(const SkipListPoolAllocator &) = delete;
+        SkipListPoolAllocator &operator=(const SkipListPoolAllocator &) = delete;
+
+        // Move constructor takes ownership of the other allocator's chunks...
+        SkipListPoolAllocator(SkipListPoolAllocator &&Other) noexcept
+          : m_Chunks(std::exchange(Other.m_Chunks, nullptr)),
+            m_Cursor(std::exchange(Other.m_Cursor, nullptr)),
+            m_ChunkEnd(std::exchange(Other.m_ChunkEnd, nullptr)),
+            m_FreeLists(std::exchange(Other.m_FreeLists, FreeListsType{})),
+            m_ReservedBytes(std::exchange(Other.m_ReservedBytes, 0)),
+            m_SharedPools(std::move(Other.m_SharedPools))
+        {
+            Other.m_SharedPools.clear();
+        }
 
-            // Examine each level, from the highest level to the lowest for
-            //  location to of node to delete...
-            for(int CurrentLevel = m_HighestLevel;
-                CurrentLevel >= 0;
-              --CurrentLevel)
+        // Take ownership of the other allocator's chunks, and of the nodes on
+        //  its free lists, leaving it empty. We keep carving from our current
+        //  chunk if we have one, otherwise we carry on from the other's...
+        void Absorb(SkipListPoolAllocator &Other)
+        {
+            // Share whatever chunks it shared that we don't already, first, so
+            //  nothing has changed if that throws...
+            for(const std::shared_ptr<SkipListPoolAllocator> &SharedPool : Other.m_SharedPools)
             {
-                // Keep moving right on this level as far as we can without
-                //  overshooting the location to insert or update the given
-                //  key...
-                while(IsLessThan(CurrentNode->GetForwardPointer(CurrentLevel)->GetKey(), Key))
-                    CurrentNode = CurrentNode->GetForwardPointer(CurrentLevel);
-
-                // Save the node on the left that will need to be spliced to the
-                //  one on the right of the node to be deleted...
-                UpdatedPointers.at(CurrentLevel) = CurrentNode;
+                if(std::find(m_SharedPools.cbegin(), m_SharedPools.cend(), SharedPool) == m_SharedPools.cend())
+                    m_SharedPools.push_back(SharedPool);
             }
 
-            // The next node is either the node to be deleted if it exists, or
-            //  not...
-            CurrentNode = CurrentNode->GetForwardPointer(0);
-
-            // This node does not have the key we are looking for, so signal to
-            //  caller it did not exist...
-            if(CurrentNode->GetKey() != Key)
-                return 0;
+            // Splice its chunks in front of ours...
+            if(Other.m_Chunks)
+            {
+                ChunkType *LastChunk = Other.m_Chunks;
+                while(LastChunk->m_Next)
+                    LastChunk = LastChunk->m_Next;
+                LastChunk->m_Next = std::exchange(m_Chunks, Other.m_Chunks);
+            }
 
-            // Otherwise we've found the node with the key we need to delete...
-            else
+            // Splice each of its free lists in front of ours...
+            for(int Height = 0; Height <= MaximumLevels; ++Height)
             {
-                // Splice pointers to point through the node we're about to
-                //  delete to the next over...
-                for(int CurrentLevel = 0; CurrentLevel <= m_HighestLevel; ++CurrentLevel)
+                if(FreeNodeType * const FreeNodes = Other.m_FreeLists[Height])
                 {
-                    // If this node did not point to the one to be deleted, then
-                    //  we can skip it...
-                    if(UpdatedPointers.at(CurrentLevel)->GetForwardPointer(CurrentLevel) != CurrentNode)
-                        break;
-
-                    // Repair link between node on the left to the one to the
-                    //  next one to the right of the node to be deleted...
-                    UpdatedPointers.at(CurrentLevel)->SetForwardPointer(
-                        CurrentLevel,
-                        CurrentNode->GetForwardPointer(CurrentLevel));
+                    FreeNodeType *LastFreeNode = FreeNodes;
+                    while(LastFreeNode->m_Next)
+                        LastFreeNode = LastFreeNode->m_Next;
+                    LastFreeNode->m_Next = std::exchange(m_FreeLists[Height], FreeNodes);
                 }
+            }
 
-                // De-allocate the node...
-                delete CurrentNode;
-                CurrentNode = nullptr;
-
-                // If we deleted the node with the highest level, adjust the
-                //  list's highest level down to match the next highest...
-                while(m_HighestLevel > 0 && !m_Header->GetForwardPointer(m_HighestLevel))
-                  --m_HighestLevel;
-
-                // Update the number of elements...
-              --m_Size;
-
-                // Signal to user deletion of a single element...
-                return 1;
+            // Carry on from its current chunk if we don't have one...
+            if(!m_Cursor)
+            {
+                m_Cursor    = Other.m_Cursor;
+                m_ChunkEnd  = Other.m_ChunkEnd;
             }
+            m_ReservedBytes += Other.m_ReservedBytes;
+
+            // It no longer owns anything...
+            Other.m_Chunks          = nullptr;
+            Other.m_Cursor          = nullptr;
+            Other.m_ChunkEnd        = nullptr;
+            Other.m_FreeLists.fill(nullptr);
+            Other.m_ReservedBytes   = 0;
+            Other.m_SharedPools.clear();
         }
 
-        // Get the number of elements...
-        size_type GetSize() const noexcept { return m_Size; }
-
-        // Insert the given key and value if it does not exist, or update its
-        //  value if it does...
-        void Insert(KeyType Key, ValueType Value)
+        // Allocate storage for a node of the given size and height...
+        void *Allocate(
+            const std::size_t Bytes,
+            const std::size_t Alignment,
+            const int Height)
         {
-            // Vector of forward pointers to maintain that is populated after
-            //  the search is completed, but before performing the actual
-            //  splice. Each level contains the rightmost node of that level or
-            //  higher that is to the left of the location of the pending
-            //  insertion...
-            typename SkipList<KeyType, ValueType, LessThanComparisonType, MaximumLevels>::NodeType::ForwardPointersType
-                UpdatedPointers{};
-
-            // Start with the header node...
-            NodeType *CurrentNode = m_Header;
-
-            // Examine each level, from the highest level to the lowest for
-            //  location to update node or insert new one...
-            for(int CurrentLevel = m_HighestLevel;
-                CurrentLevel >= 0;
-              --CurrentLevel)
+            // Check invariants...
+            assert(Height > 0 && Height <= MaximumLevels);
+            assert(Alignment <= alignof(ChunkType));
+            assert(Bytes >= sizeof(FreeNodeType));
+
+            // Recycle a previously released node of the same height, if
+            //  any...
+            if(FreeNodeType * const FreeNode = m_FreeLists[Height])
             {
-                // Keep moving right on this level as far as we can without
-                //  overshooting the location to insert or update the given
-                //  key...
-                while(IsLessThan(CurrentNode->GetForwardPointer(CurrentLevel)->GetKey(), Key))
-                    CurrentNode = CurrentNode->GetForwardPointer(CurrentLevel);
-
-                // Check invariants...
-
-                    // The node we are at should always be less than the key to
-                    //  be inserted or updated...
-                    assert(IsLessThan(CurrentNode->GetKey(), Key));
-
-                    // The given key should also always be less than or equal to
-                    //  the next one over...
-                    assert(IsLessThanOrEqual(
-                        Key,
-                        CurrentNode->GetForwardPointer(CurrentLevel)->GetKey()));
-
-                // Save the node on the left that will need to be spliced to the
-                //  new node after it is created...
-                UpdatedPointers.at(CurrentLevel) = CurrentNode;
+                m_FreeLists[Height] = FreeNode->m_Next;
+                return FreeNode;
             }
 
-            // The next node is either the key whose value is to be updated, or
-            //  the location to insert a new node at...
-            CurrentNode = CurrentNode->GetForwardPointer(0);
-
-            // This node has the given key, so update its value and we're
-            //  done...
-            if(CurrentNode->GetKey() == Key)
-                CurrentNode->SetValue(std::move(Value));
-
-            // Otherwise the key does not exist and we need to insert a new
-            //  node...
-            else
+            // Otherwise carve it out of the current chunk, starting a new one
+            //  if there isn't enough room left...
+            std::byte *Storage = AlignUp(m_Cursor, Alignment);
+            if(!m_Cursor || (static_cast<std::size_t>(m_ChunkEnd - Storage) < Bytes))
             {
-                // Generate a random level for the proposed node...
-                const int NewRandomLevel = GetRandomLevel();
-
-                // The new random level is higher than the current highest
-                //  level node in the list...
-                if(NewRandomLevel > m_HighestLevel)
-                {
-                    // Remember to update the header's forward pointers above
-                    //  the previous highest level...
-                    for(int CurrentLevel = m_HighestLevel + 1;
-                        CurrentLevel <= NewRandomLevel;
-                      ++CurrentLevel)
-                        UpdatedPointers.at(CurrentLevel) = m_Header;
+                AllocateChunk(std::max(ChunkSize, Bytes));
+                Storage = m_Cursor;
+            }
 
-                    // Remember that we've increased the highest level in the
-                    //  list...
-                    m_HighestLevel = NewRandomLevel;
-                }
+            // Advance past the new node...
+            m_Cursor = Storage + Bytes;
 
-                // Allocate the new node and store its key and value...
-                CurrentNode = new NodeType(
-                    std::make_pair(
-                        std::move(Key),
-                        std::move(Value)));
+            // Return the node's storage...
+            return Storage;
+        }
 
-                // Splice pointers...
-                for(int CurrentLevel = 0; CurrentLevel <= m_HighestLevel; ++CurrentLevel)
-                {
-                    // ...for the new node to point to the node to its
-                    //  right...
-                    CurrentNode->SetForwardPointer(
-                        CurrentLevel, 
-                        UpdatedPointers.at(CurrentLevel)->GetForwardPointer(CurrentLevel));
+        // Release storage previously returned by Allocate() for reuse by a
+        //  node of the same height...
+        void Deallocate(
+            void * const Storage,
+            [[maybe_unused]] const std::size_t Bytes,
+            const int Height) noexcept
+        {
+            // Check invariants...
+            assert(Height > 0 && Height <= MaximumLevels);
 
-                    // ...and for the preceeding nodes that need to point to
-                    //  it...
-                    UpdatedPointers.at(CurrentLevel)->SetForwardPointer(CurrentLevel, CurrentNode);
-                }
-                
-                // Update node count...
-              ++m_Size;
-            }
+            // Push it onto the free list for its height...
+            FreeNodeType * const FreeNode = static_cast<FreeNodeType *>(Storage);
+            FreeNode->m_Next = m_FreeLists[Height];
+            m_FreeLists[Height] = FreeNode;
         }
 
-        // Search for the given key, returning an iterator to its key value pair
-        //  if found, or the terminal node if not...
-        iterator Search(const KeyType &SearchKey) const noexcept
+        // Release every node at once, without visiting any of them...
+        void DeallocateAll() noexcept
         {
-            // Start with the header node...
-            NodeType *CurrentNode = m_Header;
-
-            // Examine each level, from the highest level to the lowest...
-            for(int CurrentLevel = m_HighestLevel;
-                CurrentLevel >= 0;
-              --CurrentLevel)
+            // Free each chunk...
+            while(m_Chunks)
             {
-                // Keep moving right on this level as far as we can without
-                //  overshooting the location the search key should be located,
-                //  if it exists...
-                while(IsLessThan(CurrentNode->GetForwardPointer(CurrentLevel)->GetKey(), SearchKey))
-                    CurrentNode = CurrentNode->GetForwardPointer(CurrentLevel);
-
-                // Check invariants...
+                ChunkType * const NextChunk = m_Chunks->m_Next;
+                m_Chunks->~ChunkType();
+                ::operator delete(m_Chunks);
+                m_Chunks = NextChunk;
+            }
 
-                    // The node we are at should always be less than the key to
-                    //  search for...
-                    assert(IsLessThan(CurrentNode->GetKey(), SearchKey));
+            // Reset our state, and stop keeping any shared chunks alive...
+            m_Cursor        = nullptr;
+            m_ChunkEnd      = nullptr;
+            m_FreeLists.fill(nullptr);
+            m_ReservedBytes = 0;
+            m_SharedPools.clear();
+        }
 
-                    // The search key should also always be less than or equal
-                    //  to the next one over...
-                    assert(IsLessThanOrEqual(
-                        SearchKey,
-                        CurrentNode->GetForwardPointer(CurrentLevel)->GetKey()));
+        // Get the bytes of every chunk allocated, including their headers,
+        //  the nodes on the free lists, and the unused tail of the current
+        //  one, less those of nodes transferred to allocators we share them
+        //  with and plus those of nodes transferred to us. Allocators sharing
+        //  chunks thus add up to them without counting any twice...
+        std::size_t GetReservedBytes() const noexcept { return m_ReservedBytes; }
+
+        // Get a new allocator sharing every chunk we've allocated, so either
+        //  can release any node the other has handed out onto its own free
+        //  lists. We keep carving from our current chunk, and the new one
+        //  starts its own when it needs to...
+        SkipListPoolAllocator Share()
+        {
+            // Hand our own chunks to a pool of their own we both keep
+            //  alive...
+            if(m_Chunks)
+            {
+                const std::shared_ptr<SkipListPoolAllocator> SharedPool =
+                    std::make_shared<SkipListPoolAllocator>();
+                SharedPool->m_Chunks = std::exchange(m_Chunks, nullptr);
+                m_SharedPools.push_back(SharedPool);
             }
 
-            // The next node is the search key, if it's present at all...
-            CurrentNode = CurrentNode->GetForwardPointer(0);
-
-            // If we found the search key, initialize and return an iterator
-            //  to that node...
-            if(CurrentNode->GetKey() == SearchKey)
-                return SkipListIterator(CurrentNode);
+            // Return the new allocator sharing all of them...
+            SkipListPoolAllocator Allocator;
+            Allocator.m_SharedPools = m_SharedPools;
+            return Allocator;
+        }
 
-            // Otherwise return an iterator pointing to the end to signal not
-            //  found...
-            else
-                return SkipListIterator(m_End);
+        // Hand responsibility for a node to an allocator we're shared with.
+        //  It can already release it, since we share its chunk, so only its
+        //  bytes move over...
+        void Transfer(
+            SkipListPoolAllocator &Other,
+            const std::size_t Bytes,
+            [[maybe_unused]] const int Height) noexcept
+        {
+            assert(m_ReservedBytes >= Bytes);
+            m_ReservedBytes -= Bytes;
+            Other.m_ReservedBytes += Bytes;
         }
 
         // Destructor...
-       ~SkipList()
+       ~SkipListPoolAllocator()
         {
-            // Track the current node we are about to delete, beginning with the
-            //  header...
-            NodeType *CurrentNode = m_Header;
+            DeallocateAll();
+        }
 
-            // Keep walking the list until, deleting nodes, while there are
-            //  some...
-            while(CurrentNode)
-            {
-                // Get the pointer to the next node, if any...
-                NodeType *NextNode = CurrentNode->GetForwardPointer(0);
+    // Protected types...
+    protected:
+
+        // Chunk header, followed immediately by the chunk's node storage...
+        struct alignas(std::max_align_t) ChunkType
+        {
+            // Next chunk allocated before this one...
+            ChunkType      *m_Next;
+        };
 
-                // Delete the current node...
-                delete CurrentNode;
+        // Released node, overlaid over the storage of the node it was...
+        struct FreeNodeType
+        {
+            // Next released node of the same height...
+            FreeNodeType   *m_Next;
+        };
 
-                // Seek to the next one, if any...
-                CurrentNode = NextNode;
-            }
-        }
+        // Free lists, one for each possible height...
+        using FreeListsType = std::array<FreeNodeType *, MaximumLevels + 1>;
 
-    // Protected types...
+    // Protected methods...
     protected:
 
-        // Node type...
-        class NodeType
+        // Allocate a new chunk with room for at least the given bytes and make
+        //  it current...
+        void AllocateChunk(const std::size_t Bytes)
         {
-            // Public types...
-            public:
+            // Allocate the chunk's header along with its storage...
+            void * const Storage = ::operator new(sizeof(ChunkType) + Bytes);
+            m_ReservedBytes += sizeof(ChunkType) + Bytes;
 
-				// Alias for the skip list's key value type...
-				using value_type = KeyValueType;
+            // Link it onto the list of chunks...
+            ChunkType * const Chunk = new(Storage) ChunkType{m_Chunks};
+            m_Chunks = Chunk;
 
-            // Public methods...
-            public:
+            // Node storage begins right after the header...
+            m_Cursor    = reinterpret_cast<std::byte *>(Chunk + 1);
+            m_ChunkEnd  = m_Cursor + Bytes;
+        }
 
-                // Default constructor has default initialized values...
-                NodeType()
-                  : m_KeyValue(std::make_pair(KeyType(), ValueType())),
-                    m_ForwardPointers{}
-                {
-                }
+        // Round the given address up to the given alignment...
+        static std::byte *AlignUp(std::byte * const Address, const std::size_t Alignment) noexcept
+        {
+            const std::uintptr_t Value = reinterpret_cast<std::uintptr_t>(Address);
+            return reinterpret_cast<std::byte *>((Value + Alignment - 1) & ~(Alignment - 1));
+        }
 
-                // Construct by key and value...
-                explicit NodeType(KeyValueType KeyValue)
-                  : m_KeyValue(std::move(KeyValue)),
-                    m_ForwardPointers{}
-                {
-                }
+    // Protected attributes...
+    protected:
 
-                // Get the forward pointer for the given level...
-                NodeType *GetForwardPointer(const int Level) noexcept
-                {
-                    //return m_ForwardPointers.at(Level);
-                    return m_ForwardPointers[Level];    /* Without bounds checking to allow callers to be const */
-                }
+        // Most recently allocated chunk, linked to the ones before it...
+        ChunkType                  *m_Chunks;
 
-                // Get the key...
-                const KeyType &GetKey() const noexcept { return m_KeyValue.first; }
+        // Next free byte in the current chunk...
+        std::byte                  *m_Cursor;
 
-                // Get the key and value pair...
-                KeyValueType &GetKeyValue() noexcept { return m_KeyValue; }
-                const KeyValueType &GetKeyValue() const noexcept { return m_KeyValue; }
+        // One past the last byte in the current chunk...
+        std::byte                  *m_ChunkEnd;
 
-                // Get the level...
-                int GetLevel() const noexcept
-                {
-                    // Variable to track level of node...
-                    int Level = 0;
+        // Released nodes awaiting reuse, by height...
+        FreeListsType               m_FreeLists;
 
-                    // Examine each forward pointer...
-                    for(const auto Node : m_ForwardPointers)
+        // Bytes of every chunk allocated, adjusted by those of nodes
+        //  transferred...
+        std::size_t                 m_ReservedBytes;
+
+        // Pools holding chunks we share with other allocators...
+        std::vector<std::shared_ptr<SkipListPoolAllocator>>
+                                    m_SharedPools;
+};
+
+// Level generator drawing every level of a new node from a single 64-bit
+//  random word. Each run of trailing zero bits, taken a group at a time, is a
+//  run of promotions, so a node is promoted to each next level with
+//  probability one over the given denominator, which must be a power of two.
+//  Words come from wyrand where 128-bit multiplication is available, and
+//  from splitmix64 otherwise. Each generator is seeded from a random device,
+//  unless deterministic, in which case every generator starts from the same
+//  seed so the same sequence of operations always builds the same list. An
+//  explicit seed may also be given. Each list owns its generator, rather than
+//  every list on a thread sharing a thread local one, so that a seed fixes
+//  the list a sequence of operations builds whichever thread performs them.
+//  It costs the list only eight bytes. For the same reason, lists a list
+//  builds for itself, such as those SplitAt() returns or ParallelBulkLoad()
+//  fills in pieces, are seeded from words drawn from its own generator. Any
+//  level generator given to the skip list must provide the following, and
+//  may also provide the denominator of its promotion probability, for
+//  balanced levels to promote as rarely, taken to be two otherwise, and a
+//  way to draw words to seed other generators with...
+//
+//      int GetLevel(int MaximumLevels) noexcept;   /* In [0, MaximumLevels) */
+//      static constexpr unsigned Denominator;      /* Optional */
+//      std::uint64_t GetNextWord() noexcept;       /* Optional, along with */
+//      explicit Generator(std::uint64_t Seed);     /*  a seeded constructor */
+//
+template
+<
+    unsigned    PromotionDenominator = 2,                                       /* Promote with probability 1 / PromotionDenominator */
+    bool        Deterministic = false                                           /* Use a fixed seed by default */
+>
+class SkipListLevelGenerator
+{
+    // Check invariants...
+    static_assert((PromotionDenominator >= 2) &&
+                  ((PromotionDenominator & (PromotionDenominator - 1)) == 0),
+                  "The promotion denominator must be a power of two.");
+
+    // Public constants...
+    public:
+
+        // Denominator of the probability of promotion to each next level...
+        static constexpr unsigned Denominator = PromotionDenominator;
+
+    // Public methods...
+    public:
+
+        // Default constructor seeds randomly, unless deterministic...
+        SkipListLevelGenerator()
+          : m_State(Deterministic ? DefaultSeed : GetRandomSeed())
+        {
+        }
+
+        // Constructor with an explicit seed...
+        explicit SkipListLevelGenerator(const std::uint64_t Seed) noexcept
+          : m_State(Seed)
+        {
+        }
+
+        // Select a random level below the given maximum...
+        int GetLevel(const int MaximumLevels) noexcept
+        {
+            // Number of random bits consumed by each coin flip...
+            constexpr int BitsPerPromotion = CountTrailingZeros(PromotionDenominator);
+
+            // Each group of trailing zero bits is a promotion. An all zero
+            //  word promotes as far as possible...
+            const std::uint64_t Word = GetNextWord();
+            const int Promotions = Word
+                ? (CountTrailingZeros(Word) / BitsPerPromotion)
+                : (MaximumLevels - 1);
+
+            // Never increase passed the maximum permissible...
+            return std::min(Promotions, MaximumLevels - 1);
+        }
+
+        // Advance the generator and return its next word...
+        std::uint64_t GetNextWord() noexcept
+        {
+            // Both generators advance a Weyl sequence...
+            m_State += 0xA0761D6478BD642Full;
+
+        #if defined(__SIZEOF_INT128__)
+            // wyrand mixes it with a single wide multiplication...
+            const __uint128_t Product =
+                static_cast<__uint128_t>(m_State) * (m_State ^ 0xE7037ED1A0B428DBull);
+            return static_cast<std::uint64_t>(Product >> 64) ^ static_cast<std::uint64_t>(Product);
+        #else
+            // splitmix64 mixes it with two narrow ones...
+            std::uint64_t Word = m_State;
+            Word = (Word ^ (Word >> 30)) * 0xBF58476D1CE4E5B9ull;
+            Word = (Word ^ (Word >> 27)) * 0x94D049BB133111EBull;
+            return Word ^ (Word >> 31);
+        #endif
+        }
+
+    // Protected constants...
+    protected:
+
+        // Seed used by deterministic generators...
+        static constexpr std::uint64_t DefaultSeed = 0x9E3779B97F4A7C15ull;
+
+    // Protected methods...
+    protected:
+
+        // Count the trailing zero bits of the given non-zero word...
+        static constexpr int CountTrailingZeros(const std::uint64_t Word) noexcept
+        {
+        #if defined(__GNUC__) || defined(__clang__)
+            return __builtin_ctzll(Word);
+        #else
+            int Count = 0;
+            for(std::uint64_t Bits = Word; !(Bits & 1); Bits >>= 1)
+              ++Count;
+            return Count;
+        #endif
+        }
+
+        // Draw a seed from a random device...
+        static std::uint64_t GetRandomSeed()
+        {
+            std::random_device RandomDevice;
+            return (static_cast<std::uint64_t>(RandomDevice()) << 32) | RandomDevice();
+        }
+
+    // Protected attributes...
+    protected:
+
+        // Generator state...
+        std::uint64_t   m_State;
+};
+
+// Denominator of the given level generator's promotion probability, or two if
+//  it doesn't say...
+template <typename LevelGeneratorType, typename = void>
+struct SkipListPromotionDenominator : std::integral_constant<unsigned, 2> {};
+template <typename LevelGeneratorType>
+struct SkipListPromotionDenominator<LevelGeneratorType, std::void_t<decltype(LevelGeneratorType::Denominator)>>
+  : std::integral_constant<unsigned, LevelGeneratorType::Denominator> {};
+
+// Operations whose search paths a skip list keeping statistics counts...
+enum class SkipListOperation
+{
+    Search,
+    Insert,
+    Delete,
+    Count                                                                       /* Number of operations */
+};
+
+// Snapshot of a skip list's statistics, as returned by GetStatistics(), to
+//  report wherever metrics are collected...
+struct SkipListStatistics
+{
+    // Number of each operation performed, indexed by SkipListOperation...
+    std::array<std::uint64_t, static_cast<std::size_t>(SkipListOperation::Count)>
+                                Operations{};
+
+    // Total search path length of each operation, counting every step right
+    //  along a level and every level examined...
+    std::array<std::uint64_t, static_cast<std::size_t>(SkipListOperation::Count)>
+                                PathLengths{};
+
+    // Calls made to the comparison object...
+    std::uint64_t               Comparisons = 0;
+
+    // Steps right taken along each level, indexed from the bottom...
+    std::vector<std::uint64_t>  Hops;
+
+    // Number of nodes of each height, indexed by height less one...
+    std::vector<std::size_t>    LevelHistogram;
+
+    // Highest level of any node, counting from zero...
+    int                         HighestLevel = 0;
+
+    // Number of elements...
+    std::size_t                 Size = 0;
+
+    // Bytes of node storage per element, including the header, but not any
+    //  overhead within the allocator...
+    double                      BytesPerEntry = 0.0;
+
+    // Average search path length of the given operation...
+    double GetAveragePathLength(const SkipListOperation Operation) const noexcept
+    {
+        const std::size_t Index = static_cast<std::size_t>(Operation);
+        return Operations[Index]
+            ? static_cast<double>(PathLengths[Index]) / static_cast<double>(Operations[Index])
+            : 0.0;
+    }
+};
+
+// Breakdown of the memory a skip list occupies, as returned by MemoryUsage(),
+//  in bytes...
+struct SkipListMemoryUsage
+{
+    // Fixed part of every node besides its key and value, such as its height,
+    //  any backward pointer, and padding, and all of the header...
+    std::size_t                 NodeHeaders = 0;
+
+    // Forward pointers in every node's tower, including the header's...
+    std::size_t                 ForwardPointers = 0;
+
+    // Widths alongside the forward pointers, if the list is indexable...
+    std::size_t                 Widths = 0;
+
+    // Keys and values...
+    std::size_t                 Payloads = 0;
+
+    // Held by the node allocator but not occupied by a node, such as released
+    //  nodes awaiting reuse, unused space at the end of each chunk, and
+    //  rounding. Zero if the allocator doesn't report what it holds...
+    std::size_t                 AllocatorSlack = 0;
+
+    // The skip list object itself, including its level generator's state
+    //  and its allocator...
+    std::size_t                 ListObject = 0;
+
+    // Total of all of the above...
+    std::size_t GetTotal() const noexcept
+    {
+        return NodeHeaders + ForwardPointers + Widths + Payloads + AllocatorSlack + ListObject;
+    }
+};
+
+// Variable length unsigned integers as written to serialised skip lists, seven
+//  bits to a byte beginning with the least significant, with the top bit of
+//  every byte but the last set...
+struct SkipListVarint
+{
+    // Append the given integer to the given buffer...
+    static void Encode(std::uint64_t Value, std::vector<unsigned char> &Buffer)
+    {
+        for(; Value >= 0x80; Value >>= 7)
+            Buffer.push_back(static_cast<unsigned char>(Value | 0x80));
+        Buffer.push_back(static_cast<unsigned char>(Value));
+    }
+
+    // Decode an integer from the given bytes, advancing past it. Throws
+    //  std::runtime_error if they end first or it's too large...
+    static std::uint64_t Decode(const unsigned char *&Cursor, const unsigned char * const End)
+    {
+        std::uint64_t Value = 0;
+        for(unsigned Shift = 0; Shift < 64; Shift += 7)
+        {
+            if(Cursor == End)
+                throw std::runtime_error("Truncated skip list stream.");
+            const unsigned char Byte = *Cursor++;
+            Value |= static_cast<std::uint64_t>(Byte & 0x7F) << Shift;
+            if(!(Byte & 0x80))
+                return Value;
+        }
+        throw std::runtime_error("Malformed integer in skip list stream.");
+    }
+};
+
+// How keys and values are encoded when a skip list is serialised. Integers
+//  are written as variable length integers, zigzag encoded if signed so that
+//  small negative ones stay short. Other trivially copyable types are written
+//  byte for byte, and strings as their variable length size followed by their
+//  characters. Specialise this for any other type, providing the following...
+//
+//      static void Encode(const Type &Value, std::vector<unsigned char> &Buffer);
+//      static Type Decode(const unsigned char *&Cursor, const unsigned char *End);
+//
+//  Decode() advances past what it decodes, and throws std::runtime_error if
+//  the bytes end first...
+template <typename Type, typename = void>
+struct SkipListCodec
+{
+    static_assert(std::is_trivially_copyable_v<Type>,
+                  "Specialise SkipListCodec to serialise types that aren't trivially copyable.");
+
+    // Append the value's bytes...
+    static void Encode(const Type &Value, std::vector<unsigned char> &Buffer)
+    {
+        const unsigned char * const Bytes = reinterpret_cast<const unsigned char *>(&Value);
+        Buffer.insert(Buffer.end(), Bytes, Bytes + sizeof(Type));
+    }
+
+    // Copy the value's bytes back out...
+    static Type Decode(const unsigned char *&Cursor, const unsigned char * const End)
+    {
+        if(static_cast<std::size_t>(End - Cursor) < sizeof(Type))
+            throw std::runtime_error("Truncated skip list stream.");
+        Type Value;
+        std::memcpy(&Value, Cursor, sizeof(Type));
+        Cursor += sizeof(Type);
+        return Value;
+    }
+};
+
+// Integers...
+template <typename Type>
+struct SkipListCodec<Type, std::enable_if_t<std::is_integral_v<Type> && !std::is_same_v<Type, bool>>>
+{
+    // Unsigned equivalent...
+    using UnsignedType = std::make_unsigned_t<Type>;
+
+    // Append the integer, zigzag encoded if signed...
+    static void Encode(const Type &Value, std::vector<unsigned char> &Buffer)
+    {
+        if constexpr(std::is_signed_v<Type>)
+            SkipListVarint::Encode(static_cast<UnsignedType>(
+                static_cast<UnsignedType>(static_cast<UnsignedType>(Value) << 1) ^
+                static_cast<UnsignedType>(Value < 0 ? -1 : 0)), Buffer);
+        else
+            SkipListVarint::Encode(Value, Buffer);
+    }
+
+    // Decode it back...
+    static Type Decode(const unsigned char *&Cursor, const unsigned char * const End)
+    {
+        const std::uint64_t Encoded = SkipListVarint::Decode(Cursor, End);
+        if(Encoded > std::numeric_limits<UnsignedType>::max())
+            throw std::runtime_error("Integer out of range in skip list stream.");
+        const UnsignedType Value = static_cast<UnsignedType>(Encoded);
+        if constexpr(std::is_signed_v<Type>)
+            return static_cast<Type>((Value >> 1) ^ (UnsignedType(0) - (Value & 1)));
+        else
+            return Value;
+    }
+};
+
+// Strings of trivially copyable characters...
+template <typename CharacterType, typename CharacterTraitsType, typename StringAllocatorType>
+struct SkipListCodec<std::basic_string<CharacterType, CharacterTraitsType, StringAllocatorType>>
+{
+    // String type...
+    using StringType = std::basic_string<CharacterType, CharacterTraitsType, StringAllocatorType>;
+
+    // Append the string's length, then its characters...
+    static void Encode(const StringType &Value, std::vector<unsigned char> &Buffer)
+    {
+        SkipListVarint::Encode(Value.size(), Buffer);
+        const unsigned char * const Bytes = reinterpret_cast<const unsigned char *>(Value.data());
+        Buffer.insert(Buffer.end(), Bytes, Bytes + (Value.size() * sizeof(CharacterType)));
+    }
+
+    // Decode them back...
+    static StringType Decode(const unsigned char *&Cursor, const unsigned char * const End)
+    {
+        const std::uint64_t Length = SkipListVarint::Decode(Cursor, End);
+        if(Length > static_cast<std::size_t>(End - Cursor) / sizeof(CharacterType))
+            throw std::runtime_error("Truncated skip list stream.");
+        StringType Value(static_cast<std::size_t>(Length), CharacterType());
+        std::memcpy(Value.data(), Cursor, Value.size() * sizeof(CharacterType));
+        Cursor += Value.size() * sizeof(CharacterType);
+        return Value;
+    }
+};
+
+// Default traits for a skip list's optional features. To enable a feature,
+//  derive from this and override the relevant constant or type...
+struct SkipListDefaultTraits
+{
+    // How new nodes' levels are chosen. Balanced levels promote by its
+    //  denominator too...
+    using LevelGeneratorType = SkipListLevelGenerator<>;
+
+    // Issue software prefetches for the nodes a search is about to visit
+    //  while the current comparison runs. This helps when lists are much
+    //  larger than the processor's caches, but can cost a little on lists
+    //  that already fit within them...
+    static constexpr bool Prefetch = false;
+
+    // Keep a backward pointer in every node on the bottom level, making the
+    //  list's iterators bidirectional at the cost of a pointer per node...
+    static constexpr bool BackPointers = false;
+
+    // Keep the width of every forward pointer, or the number of bottom level
+    //  steps it skips, to find any position or a key's rank in logarithmic
+    //  time, at the cost of a count per forward pointer...
+    static constexpr bool Indexable = false;
+
+    // Check whether a node's key matches the one searched for with the key
+    //  type's == rather than the comparison object. Only enable this where ==
+    //  agrees with the comparison's notion of equivalence and is cheaper.
+    //  Integral keys under the default comparison always use it...
+    static constexpr bool EqualityOperator = false;
+
+    // Count comparisons, steps along each level, and the search path length
+    //  of each search, insertion, and deletion, for GetStatistics(). This
+    //  costs a few increments on every search, so it's compiled out
+    //  otherwise...
+    static constexpr bool Statistics = false;
+
+    // Mark each node when it or the gap after it changes, along with the
+    //  span containing it on every level above, so SerializeChanges() can
+    //  find every changed range without walking the whole list. This costs
+    //  a word in every node, and a store on every level for each change...
+    static constexpr bool Checkpoints = false;
+
+    // Allow several key value pairs with equivalent keys, as a multimap
+    //  does. A new pair is inserted after every other with an equivalent
+    //  key, so equal keys stay in the order they were inserted, and
+    //  deleting a key deletes all of its pairs. Checkpoints can't be kept,
+    //  since the ranges they describe are bounded by keys that could no
+    //  longer tell such pairs apart...
+    static constexpr bool DuplicateKeys = false;
+};
+
+// Traits enabling software prefetching...
+struct SkipListPrefetchTraits : SkipListDefaultTraits
+{
+    static constexpr bool Prefetch = true;
+};
+
+// Traits enabling back pointers...
+struct SkipListBackPointerTraits : SkipListDefaultTraits
+{
+    static constexpr bool BackPointers = true;
+};
+
+// Traits enabling positional access...
+struct SkipListIndexableTraits : SkipListDefaultTraits
+{
+    static constexpr bool Indexable = true;
+};
+
+// Traits keeping statistics...
+struct SkipListStatisticsTraits : SkipListDefaultTraits
+{
+    static constexpr bool Statistics = true;
+};
+
+// Traits enabling incremental checkpoints...
+struct SkipListCheckpointTraits : SkipListDefaultTraits
+{
+    static constexpr bool Checkpoints = true;
+};
+
+// Traits allowing duplicate keys...
+struct SkipListMultimapTraits : SkipListDefaultTraits
+{
+    static constexpr bool DuplicateKeys = true;
+};
+
+// Traits drawing the same levels every run, for reproducible benchmarks and
+//  debugging...
+struct SkipListDeterministicTraits : SkipListDefaultTraits
+{
+    using LevelGeneratorType = SkipListLevelGenerator<2, true>;
+};
+
+// Tag selecting the skip list constructor that builds from an already sorted
+//  range of key value pairs...
+struct SkipListFromSortedRangeType
+{
+    explicit SkipListFromSortedRangeType() = default;
+};
+inline constexpr SkipListFromSortedRangeType SkipListFromSortedRange{};
+
+// How a bulk load assigns levels to new nodes...
+enum class SkipListLevelAssignment
+{
+    // Draw each node's level at random, exactly as an insertion would...
+    Random,
+
+    // Assign the levels of a perfectly balanced skip list, where every second
+    //  node reaches level one, every fourth level two, and so on...
+    Balanced
+};
+
+// Skip list is a data structure discovered by William Pugh (1989) that can be
+//  used in place of balanced trees. It uses probabilistic balancing. It works
+//  well if the elements are inserted in random order, or, unlike a binary tree,
+//  in sorted order too. It has the same asymptotic expected time bounds as a
+//  binary tree, but is simpler to implement, faster, and uses less storage...
+template
+<
+    typename    KeyType,                                                        /* Key type */
+    typename    ValueType,                                                      /* Value type associated with key */
+    typename    LessThanComparisonType = decltype(std::less<KeyType>()),        /* How to compare keys to each other */
+    int         MaximumLevels = 16,                                             /* Maximum number of levels, each indexed from [0, MaximumLevel) */
+    typename    AllocatorType = SkipListPoolAllocator<MaximumLevels>,           /* Node allocator */
+    typename    TraitsType = SkipListDefaultTraits                              /* Optional features */
+>
+class SkipList
+{
+    // Check invariants...
+    static_assert(!(TraitsType::DuplicateKeys && TraitsType::Checkpoints),
+                  "A skip list allowing duplicate keys can't keep checkpoints.");
+
+    // Protected forward declarations...
+    protected:
+
+        // Node type will be defined later...
+        class NodeType;
+
+    // Public forward declarations...
+    public:
+
+        // Range view type will be defined later...
+        template <typename BoundKeyType>
+        class RangeType;
+
+    // Public types...
+    public:
+
+        // Key-value type...
+        using KeyValueType      = std::pair<const KeyType, ValueType>;
+
+        // Type alias for iterator...
+        using iterator          = SkipListIterator<NodeType>;
+
+        // Type alias for const iterator...
+        using const_iterator    = iterator;
+
+        // Type aliases for reverse iterators, only for lists with back
+        //  pointers...
+        using reverse_iterator          = std::reverse_iterator<iterator>;
+        using const_reverse_iterator    = std::reverse_iterator<const_iterator>;
+
+        // Type alias for how we count elements...
+        using size_type         = std::size_t;
+
+        // How new nodes' levels are chosen...
+        using LevelGeneratorType = typename TraitsType::LevelGeneratorType;
+
+    // Public methods...
+    public:
+
+        // Constructor. Pass a level generator with a fixed seed for
+        //  deterministic behaviour during debugging...
+        explicit SkipList(
+            const LessThanComparisonType &LessThanCompare = LessThanComparisonType(),
+            AllocatorType Allocator = AllocatorType(),
+            LevelGeneratorType LevelGenerator = LevelGeneratorType())
+          : m_Header(nullptr),
+            m_HintFingerValid(false),
+            m_HighestLevel(0),
+            m_LessThanComparison(LessThanCompare),
+            m_LevelGenerator(std::move(LevelGenerator)),
+            m_Size(0),
+            m_TowerLevels(0),
+            m_Allocator(std::move(Allocator))
+        {
+            // Allocate the head node with a tower as tall as the list could
+            //  ever grow. Its forward pointers all begin null, which marks the
+            //  end of the list on every level...
+            m_Header = CreateSentinelNode(MaximumLevels);
+
+            // With no other nodes, the header is the rightmost on every
+            //  level, and points back to itself...
+            m_RightmostNodes.fill(m_Header);
+            UpdateBackPointer(m_Header);
+
+            // The header's bottom level skips to one past the end...
+            if constexpr(TraitsType::Indexable)
+                m_Header->SetWidth(0, 1);
+        }
+
+        // Construct from a range of key value pairs already sorted by key,
+        //  without performing any searches. See BulkLoad()...
+        template <typename InputIteratorType>
+        SkipList(
+            SkipListFromSortedRangeType,
+            InputIteratorType First,
+            const InputIteratorType Last,
+            const SkipListLevelAssignment LevelAssignment = SkipListLevelAssignment::Random,
+            const LessThanComparisonType &LessThanCompare = LessThanComparisonType(),
+            AllocatorType Allocator = AllocatorType(),
+            LevelGeneratorType LevelGenerator = LevelGeneratorType())
+          : SkipList(LessThanCompare, std::move(Allocator), std::move(LevelGenerator))
+        {
+            BulkLoad(First, Last, LevelAssignment);
+        }
+
+        // Nodes are owned by exactly one list...
+        SkipList(const SkipList &) = delete;
+        SkipList &operator=(const SkipList &) = delete;
+
+        // Retrieve an iterator start...
+        iterator begin() noexcept
+        {
+            // Should point to either the first node after the header, or the
+            //  end if there aren't any...
+            return MakeIterator(m_Header->GetForwardPointer(0));
+        }
+
+        // Retrieve a const iterator start...
+        const_iterator begin() const noexcept
+        {
+            // Should point to either the first node after the header, or the
+            //  end if there aren't any...
+            return MakeIterator(m_Header->GetForwardPointer(0));
+        }
+
+        // Retrieve a const iterator start...
+        const_iterator cbegin() const noexcept
+        {
+            // Should point to either the first node after the header, or the
+            //  end if there aren't any...
+            return MakeIterator(m_Header->GetForwardPointer(0));
+        }
+
+        // Retrieve an iterator end which is the next value after the last valid
+        //  one. The end of the list is marked by a null forward pointer...
+        iterator end() noexcept
+        {
+            return MakeIterator(nullptr);
+        }
+
+        // Retrieve a const iterator end which is the next value after the last
+        //  valid one. The end of the list is marked by a null forward
+        //  pointer...
+        const_iterator end() const noexcept
+        {
+            return MakeIterator(nullptr);
+        }
+
+        // Retrieve a const iterator end which is the next value after the last
+        //  valid one. The end of the list is marked by a null forward
+        //  pointer...
+        const_iterator cend() const noexcept
+        {
+            return MakeIterator(nullptr);
+        }
+
+        // Retrieve a reverse iterator start, at the last key value pair. Only
+        //  for lists with back pointers...
+        reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(cend()); }
+
+        // Retrieve a reverse iterator end, before the first key value pair.
+        //  Only for lists with back pointers...
+        reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+        const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+        const_reverse_iterator crend() const noexcept { return const_reverse_iterator(cbegin()); }
+
+        // Retrieve an iterator to the key value pair at the given zero based
+        //  position in key order in logarithmic time, or the end if there
+        //  isn't one. Only available if the list is indexable...
+        iterator At(const size_type Index) const noexcept
+        {
+            static_assert(TraitsType::Indexable, "At() requires an indexable skip list");
+
+            // Out of range...
+            if(Index >= m_Size)
+                return end();
+
+            // Skip right on each level as far as we can without passing the
+            //  node whose rank, counting the header as zero, is one past the
+            //  index...
+            const size_type TargetRank = Index + 1;
+            size_type Rank = 0;
+            NodeType *CurrentNode = m_Header;
+            for(int CurrentLevel = m_HighestLevel; CurrentLevel >= 0; --CurrentLevel)
+            {
+                while(Rank + CurrentNode->GetWidth(CurrentLevel) <= TargetRank)
+                {
+                    Rank += CurrentNode->GetWidth(CurrentLevel);
+                    CurrentNode = CurrentNode->GetForwardPointer(CurrentLevel);
+                }
+
+                // Stop as soon as we've landed on it...
+                if(Rank == TargetRank)
+                    break;
+            }
+
+            // Return it...
+            assert(Rank == TargetRank);
+            return MakeIterator(CurrentNode);
+        }
+
+        // Append a range of key value pairs, sorted by key, to the end of the
+        //  list in a single pass without performing any searches. Every key
+        //  must be no less than the last already in the list. Runs of equal
+        //  keys behave as successive insertions would, with the last value
+        //  winning, or each appended in turn if the list allows duplicate
+        //  keys...
+        template <typename InputIteratorType>
+        void BulkLoad(
+            InputIteratorType First,
+            const InputIteratorType Last,
+            const SkipListLevelAssignment LevelAssignment = SkipListLevelAssignment::Random)
+        {
+            AppendSorted(std::move(First), Last, LevelAssignment, 0);
+        }
+
+        // Clear all elements...
+        void Clear() noexcept
+        {
+            // Release every node after the header, and forget them...
+            DestroyNodes();
+            ResetHeader();
+        }
+
+        // Count the key value pairs with keys equivalent to the given one,
+        //  which is zero or one unless the list allows duplicate keys. In
+        //  logarithmic time if the list is indexable, otherwise visiting each
+        //  pair counted...
+        template <typename OtherKeyType>
+        size_type Count(const OtherKeyType &Key) const
+        {
+            // Difference between the number of keys not greater and less...
+            const LookupKeyType<OtherKeyType> &LookupKey = Key;
+            if constexpr(TraitsType::Indexable)
+                return CountBefore<true>(LookupKey) - CountBefore(LookupKey);
+
+            // Otherwise walk the range...
+            else
+            {
+                const auto [First, Last] = EqualRange(LookupKey);
+                return static_cast<size_type>(std::distance(First, Last));
+            }
+        }
+
+        // Delete the given key and its associated value if the key exists.
+        //  Return number of deleted elements, which should be either zero or
+        //  one, unless the list allows duplicate keys. Then every pair with
+        //  the key is deleted...
+        size_type Delete(const KeyType &Key) noexcept
+        {
+            return DeleteKey(Key);
+        }
+
+        // Delete the key equivalent to the given one of another type and its
+        //  associated value, if it exists. Only available if the comparison
+        //  object is transparent. Return number of deleted elements, as
+        //  above...
+        template
+        <
+            typename OtherKeyType,
+            typename ComparisonType = LessThanComparisonType,
+            typename = typename ComparisonType::is_transparent
+        >
+        size_type Delete(const OtherKeyType &Key) noexcept
+        {
+            return DeleteKey(Key);
+        }
+
+        // Delete the key value pair the given iterator refers to, which must
+        //  not be the end. Unlike deleting by key, this deletes only that
+        //  pair, even among duplicates, finding its neighbours with a single
+        //  search. Return an iterator to the pair that followed it...
+        iterator Delete(const const_iterator Position) noexcept
+        {
+            // Count this deletion...
+            OperationScopeType Scope(m_Statistics, SkipListOperation::Delete);
+
+            // Node to delete, and the one after it...
+            NodeType * const Node = Position.m_CurrentNode;
+            assert(Node);
+            NodeType * const NextNode = Node->GetForwardPointer(0);
+
+            // Find the nodes on its left on every level, then unlink it...
+            typename NodeType::ForwardPointersType UpdatedPointers;
+            SeekNode(Node, UpdatedPointers);
+            UnlinkNode(UpdatedPointers, Node);
+
+            // Return what followed it...
+            return MakeIterator(NextNode);
+        }
+
+        // Delete each of the given keys, which must be sorted, that exists,
+        //  along with its associated value, or values if the list allows
+        //  duplicate keys. Each key's predecessors on every
+        //  level are kept as a finger for the next, so a search need only
+        //  climb as high as the distance between them requires instead of
+        //  descending from the top of the header. Return the number of
+        //  deleted elements...
+        template <typename KeyIteratorType>
+        size_type DeleteBatch(KeyIteratorType KeysBegin, const KeyIteratorType KeysEnd) noexcept
+        {
+            // The rightmost node on each level less than the previous key. To
+            //  begin with, this is the header on every level...
+            typename NodeType::ForwardPointersType Predecessors;
+            Predecessors.fill(m_Header);
+
+            // Delete each key that exists. A node to the left of a deleted one
+            //  is still to the left of the next key, so the finger remains
+            //  valid...
+            size_type Deleted = 0;
+            for(; KeysBegin != KeysEnd; ++KeysBegin)
+            {
+                // Count this deletion...
+                OperationScopeType Scope(m_Statistics, SkipListOperation::Delete);
+
+                // Key to delete, which must not be less than the previous...
+                const KeyType &Key = *KeysBegin;
+                assert((Predecessors[0] == m_Header) || IsLessThan(Predecessors[0]->GetKey(), Key));
+
+                // Unlink it if it's there, along with any duplicates following
+                //  it, which the same predecessors are to the left of...
+                NodeType *Node = SeekFromFinger(Key, Predecessors)->GetForwardPointer(0);
+                while(Node && IsMatch(Node->GetKey(), Key))
+                {
+                    UnlinkNode(Predecessors, Node);
+                  ++Deleted;
+                    if constexpr(!TraitsType::DuplicateKeys)
+                        break;
+                    Node = Predecessors[0]->GetForwardPointer(0);
+                }
+            }
+
+            // Return the number of elements deleted...
+            return Deleted;
+        }
+
+        // Delete the key value pair with the key equivalent to the given one
+        //  if the given predicate, called with the pair, returns true. If the
+        //  list allows duplicate keys, each pair with the key is offered to
+        //  the predicate in turn. Inspecting and deleting takes a single
+        //  search, rather than one to find the pair and another to delete it.
+        //  Return the number of deleted elements...
+        template <typename OtherKeyType, typename PredicateType>
+        size_type DeleteIf(const OtherKeyType &Key, PredicateType &&Predicate)
+        {
+            // Count this deletion...
+            OperationScopeType Scope(m_Statistics, SkipListOperation::Delete);
+
+            // Find the node on the left of the key on each level...
+            const LookupKeyType<OtherKeyType> &LookupKey = Key;
+            typename NodeType::ForwardPointersType UpdatedPointers;
+            SeekPredecessor(LookupKey, &UpdatedPointers);
+
+            // Offer each pair with the key to the predicate, unlinking those
+            //  it accepts. One it declines is on the left of the rest on each
+            //  of its levels...
+            size_type Deleted = 0;
+            NodeType *CurrentNode = UpdatedPointers[0]->GetForwardPointer(0);
+            while(CurrentNode && IsMatch(CurrentNode->GetKey(), LookupKey))
+            {
+                NodeType * const NextNode = CurrentNode->GetForwardPointer(0);
+                if(Predicate(std::as_const(CurrentNode->GetKeyValue())))
+                {
+                    UnlinkNode(UpdatedPointers, CurrentNode);
+                  ++Deleted;
+                }
+                else
+                    std::fill_n(UpdatedPointers.begin(), CurrentNode->GetLevel(), CurrentNode);
+                if constexpr(!TraitsType::DuplicateKeys)
+                    break;
+                CurrentNode = NextNode;
+            }
+
+            // Return the number of elements deleted...
+            return Deleted;
+        }
+
+        // Delete the first key value pair, which is to the right of only the
+        //  header, in time proportional to its level. Return whether there
+        //  was one...
+        bool PopFront() noexcept
+        {
+            // Nothing to delete...
+            NodeType * const Node = m_Header->GetForwardPointer(0);
+            if(!Node)
+                return false;
+
+            // Count this deletion...
+            OperationScopeType Scope(m_Statistics, SkipListOperation::Delete);
+
+            // The header is on its left on every level...
+            typename NodeType::ForwardPointersType UpdatedPointers;
+            UpdatedPointers.fill(m_Header);
+            UnlinkNode(UpdatedPointers, Node);
+            return true;
+        }
+
+        // Update the list from a stream written by Serialize() or
+        //  SerializeChanges(), one chunk at a time. Each range in the stream
+        //  replaces whatever the list holds within it, so a whole list's
+        //  stream replaces everything, while a stream of changes brings a list
+        //  holding the previous checkpoint up to date. The source is called as
+        //  follows to read up to the given number of bytes, returning how
+        //  many it read, which is fewer only at the end of the stream...
+        //
+        //      std::size_t Source(void *Bytes, std::size_t Size);
+        //
+        //  Throws std::runtime_error if the stream is malformed or ends early,
+        //  leaving whatever was read until then applied...
+        template <typename SourceType>
+        void Deserialize(SourceType &&Source)
+        {
+            // Check the stream's signature...
+            StreamReaderType<std::remove_reference_t<SourceType>> Reader(Source);
+
+            // Pairs left to read in the current range, and the last inserted,
+            //  after which the next belongs...
+            std::uint64_t Remaining = 0;
+            iterator LastInserted = end();
+
+            // Apply each chunk in turn...
+            while(Reader.NextChunk())
+            {
+                while(!Reader.IsChunkEnd())
+                {
+                    // Each range begins with its bounds, missing if unbounded,
+                    //  then how many pairs it now holds. Erase what we hold
+                    //  within it...
+                    if(!Remaining)
+                    {
+                        const unsigned char Bounds = Reader.DecodeByte();
+                        if(Bounds & ~(StreamHasLowerKey | StreamHasUpperKey))
+                            throw std::runtime_error("Malformed range in skip list stream.");
+                        std::optional<KeyType> LowerKey;
+                        std::optional<KeyType> UpperKey;
+                        if(Bounds & StreamHasLowerKey)
+                            LowerKey.emplace(Reader.template Decode<KeyType>());
+                        if(Bounds & StreamHasUpperKey)
+                            UpperKey.emplace(Reader.template Decode<KeyType>());
+                        if(LowerKey && UpperKey && !IsLessThan(*LowerKey, *UpperKey))
+                            throw std::runtime_error("Malformed range in skip list stream.");
+                        Erase(LowerKey ? LowerBound(*LowerKey) : begin(),
+                              UpperKey ? LowerBound(*UpperKey) : end());
+                        Remaining = Reader.DecodeVarint();
+                        LastInserted = end();
+                    }
+
+                    // Then insert each pair it holds, in order, each after the
+                    //  last...
+                    else
+                    {
+                        KeyType Key = Reader.template Decode<KeyType>();
+                        ValueType Value = Reader.template Decode<ValueType>();
+                        LastInserted = (LastInserted == end())
+                            ? TryEmplace(std::move(Key), std::move(Value)).first
+                            : Insert(LastInserted, std::move(Key), std::move(Value));
+                      --Remaining;
+                    }
+                }
+            }
+
+            // The stream ended partway through a range...
+            if(Remaining)
+                throw std::runtime_error("Truncated skip list stream.");
+        }
+
+        // Construct a key value pair in place from the given arguments and
+        //  insert it if its key does not already exist, leaving any existing
+        //  value untouched. Return an iterator to the key value pair with that
+        //  key and whether the new pair was inserted. If the list allows
+        //  duplicate keys, it's always inserted after any equivalent ones...
+        template <typename... ArgumentTypes>
+        std::pair<iterator, bool> Emplace(ArgumentTypes &&... Arguments)
+        {
+            // Count this insertion...
+            OperationScopeType Scope(m_Statistics, SkipListOperation::Insert);
+
+            // Construct the new node first, since we need its key to know
+            //  where it belongs...
+            NodeType * const NewNode = CreateNode(
+                GetRandomLevel() + 1, std::forward<ArgumentTypes>(Arguments)...);
+
+            // Find where it belongs...
+            typename NodeType::ForwardPointersType UpdatedPointers;
+            NodeType * const ExistingNode =
+                SeekInsertionPoint(NewNode->GetKey(), UpdatedPointers);
+
+            // The key already exists, so discard the new node...
+            if(ExistingNode)
+            {
+                DestroyNode(NewNode);
+                return {MakeIterator(ExistingNode), false};
+            }
+
+            // Otherwise link it in...
+            LinkNode(UpdatedPointers, NewNode);
+            return {MakeIterator(NewNode), true};
+        }
+
+        // Find the range of key value pairs with keys equivalent to the given
+        //  one, returning iterators to its first and one past its last. Unless
+        //  the list allows duplicate keys, the range holds at most one pair.
+        //  The range is empty, and both iterators refer to where the key
+        //  would belong, if the key isn't present...
+        template <typename OtherKeyType>
+        std::pair<iterator, iterator> EqualRange(const OtherKeyType &Key) const
+        {
+            // First node not less than the key...
+            const LookupKeyType<OtherKeyType> &LookupKey = Key;
+            NodeType * const FirstNode = SeekPredecessor(LookupKey)->GetForwardPointer(0);
+
+            // If it has the key, the range ends after it, or after the last of
+            //  its duplicates. Otherwise it's empty...
+            NodeType *LastNode = FirstNode;
+            while(LastNode && !IsLessThan(LookupKey, LastNode->GetKey()))
+            {
+                LastNode = LastNode->GetForwardPointer(0);
+                if constexpr(!TraitsType::DuplicateKeys)
+                    break;
+            }
+            return {MakeIterator(FirstNode), MakeIterator(LastNode)};
+        }
+
+        // Visit the key value pairs with keys equivalent to the given one, as
+        //  described for Range(). Return the number visited...
+        template <typename OtherKeyType, typename VisitorType>
+        size_type EqualRange(const OtherKeyType &Key, VisitorType &&Visitor) const
+        {
+            const auto [First, Last] = EqualRange(Key);
+            return VisitNodes(First.m_CurrentNode, Last.m_CurrentNode, Visitor);
+        }
+
+        // Erase the key value pair the given iterator refers to, which must
+        //  not be the end, exactly as Delete() does. Return an iterator to the
+        //  pair that followed it...
+        iterator Erase(const const_iterator Position) noexcept
+        {
+            return Delete(Position);
+        }
+
+        // Erase the key value pairs from the first iterator up to but not
+        //  including the last. Each level is spliced past the range once,
+        //  after a single walk over the nodes erased, which must be visited
+        //  to release them anyway. Return the number erased...
+        size_type Erase(const const_iterator First, const const_iterator Last) noexcept
+        {
+            // Nodes bounding the range. The last is null to erase to the
+            //  end...
+            NodeType * const FirstNode = First.m_CurrentNode;
+            NodeType * const LastNode  = Last.m_CurrentNode;
+            if(FirstNode == LastNode)
+                return 0;
+
+            // Find the node on the left of the first on each level...
+            typename NodeType::ForwardPointersType UpdatedPointers;
+            SeekNode(FirstNode, UpdatedPointers);
+
+            // Walk the range once along the bottom level, counting the nodes
+            //  erased. On every level, the tallest enough of them to reach it
+            //  that comes last points past the range, and their widths add
+            //  up to the span the node on the left must now cover. This finds
+            //  the range by position rather than by key, since with duplicate
+            //  keys, nodes on either side of the last may share its key...
+            std::array<NodeType *, MaximumLevels> NextNodes{};
+            [[maybe_unused]] std::array<size_type, MaximumLevels> Widths{};
+            for(int CurrentLevel = 0; CurrentLevel <= m_HighestLevel; ++CurrentLevel)
+            {
+                NextNodes[CurrentLevel] = UpdatedPointers[CurrentLevel]->GetForwardPointer(CurrentLevel);
+                if constexpr(TraitsType::Indexable)
+                    Widths[CurrentLevel] = UpdatedPointers[CurrentLevel]->GetWidth(CurrentLevel);
+            }
+            size_type Erased = 0;
+            for(NodeType *CurrentNode = FirstNode; CurrentNode != LastNode;
+                CurrentNode = CurrentNode->GetForwardPointer(0))
+            {
+              ++Erased;
+                for(int CurrentLevel = 0; CurrentLevel < CurrentNode->GetLevel(); ++CurrentLevel)
+                {
+                    NextNodes[CurrentLevel] = CurrentNode->GetForwardPointer(CurrentLevel);
+                    if constexpr(TraitsType::Indexable)
+                        Widths[CurrentLevel] += CurrentNode->GetWidth(CurrentLevel);
+                }
+            }
+
+            // Splice each level from the node on the left past the range,
+            //  narrowing its width by every node erased...
+            for(int CurrentLevel = 0; CurrentLevel <= m_HighestLevel; ++CurrentLevel)
+            {
+                NodeType * const LeftNode = UpdatedPointers[CurrentLevel];
+                NodeType * const NextNode = NextNodes[CurrentLevel];
+                LeftNode->SetForwardPointer(CurrentLevel, NextNode);
+                if constexpr(TraitsType::Indexable)
+                    LeftNode->SetWidth(CurrentLevel, Widths[CurrentLevel] - Erased);
+
+                // If nothing follows, the node on the left is now the
+                //  rightmost on this level...
+                if(!NextNode)
+                    m_RightmostNodes[CurrentLevel] = LeftNode;
+            }
+
+            // The last node, or the header if we erased to the end, now
+            //  points back to the node on the left...
+            UpdateBackPointer(UpdatedPointers[0]);
+
+            // The gap after the node on the left now holds the change...
+            MarkChanged(UpdatedPointers[0], UpdatedPointers);
+
+            // Release the erased nodes, whose own forward pointers are still
+            //  intact...
+            for(NodeType *CurrentNode = FirstNode; CurrentNode != LastNode;)
+            {
+                NodeType * const NextNode = CurrentNode->GetForwardPointer(0);
+                DestroyNode(CurrentNode);
+                CurrentNode = NextNode;
+            }
+
+            // If we erased the nodes with the highest levels, adjust the
+            //  list's highest level down to match the next highest...
+            TrimHighestLevel();
+
+            // Update the number of elements and return those erased...
+            m_Size -= Erased;
+            return Erased;
+        }
+
+        // Remove the run of key value pairs at the front of the list for which
+        //  the given predicate, called with each in order, returns true,
+        //  stopping at the first it doesn't. Each is moved to the given
+        //  output iterator before its node is released. The whole run is
+        //  spliced out of the header at once, so this takes time
+        //  proportional to the run's length and the number of levels, rather
+        //  than a deletion per key, as when expiring entries keyed by their
+        //  deadlines. If the predicate throws, nothing is removed. If the
+        //  output throws, the run is still removed. Return the output
+        //  iterator...
+        template <typename PredicateType, typename OutputIteratorType>
+        OutputIteratorType ExtractWhile(PredicateType &&Predicate, OutputIteratorType Output)
+        {
+            ExtractFront(Predicate, [&Output](KeyValueType &&KeyValue)
+            {
+                *Output = std::move(KeyValue);
+              ++Output;
+            });
+            return Output;
+        }
+
+        // As above, but discarding each key value pair removed. Return the
+        //  number removed...
+        template <typename PredicateType>
+        size_type ExtractWhile(PredicateType &&Predicate)
+        {
+            return ExtractFront(Predicate, [](KeyValueType &&) {});
+        }
+
+        // Get the number of elements...
+        size_type GetSize() const noexcept { return m_Size; }
+
+        // Take a snapshot of the list's statistics. The level histogram and
+        //  bytes per entry require walking the whole list. Only available if
+        //  the list keeps statistics...
+        SkipListStatistics GetStatistics() const
+        {
+            static_assert(TraitsType::Statistics, "GetStatistics() requires a skip list keeping statistics");
+
+            // Counters kept along the way...
+            SkipListStatistics Statistics;
+            Statistics.Operations   = m_Statistics.m_Operations;
+            Statistics.PathLengths  = m_Statistics.m_PathLengths;
+            Statistics.Comparisons  = m_Statistics.m_Comparisons;
+            Statistics.Hops.assign(m_Statistics.m_Hops.cbegin(), m_Statistics.m_Hops.cend());
+
+            // Count each height and the storage of each node...
+            Statistics.LevelHistogram.assign(MaximumLevels, 0);
+            std::size_t Bytes = NodeType::GetAllocationSize(m_Header->GetLevel());
+            for(const NodeType *CurrentNode = m_Header->GetForwardPointer(0);
+                CurrentNode;
+                CurrentNode = CurrentNode->GetForwardPointer(0))
+            {
+              ++Statistics.LevelHistogram[CurrentNode->GetLevel() - 1];
+                Bytes += NodeType::GetAllocationSize(CurrentNode->GetLevel());
+            }
+
+            // And the rest...
+            Statistics.HighestLevel     = m_HighestLevel;
+            Statistics.Size             = m_Size;
+            Statistics.BytesPerEntry    = m_Size
+                ? static_cast<double>(Bytes) / static_cast<double>(m_Size) : 0.0;
+
+            // Return the snapshot...
+            return Statistics;
+        }
+
+        // Insert the given key and value if it does not exist, or update its
+        //  value if it does. If the list allows duplicate keys, it's always
+        //  inserted, after any pairs with an equivalent key. Keys greater
+        //  than every other in the list are appended directly to the tail
+        //  without searching...
+        void Insert(KeyType Key, ValueType Value)
+        {
+            // Count this insertion...
+            OperationScopeType Scope(m_Statistics, SkipListOperation::Insert);
+
+            // Vector of forward pointers to maintain that is populated after
+            //  the search is completed, but before performing the actual
+            //  splice. Each level contains the rightmost node of that level or
+            //  higher that is to the left of the location of the pending
+            //  insertion...
+            typename NodeType::ForwardPointersType
+                UpdatedPointers;
+
+            // This node has the given key, so update its value and we're
+            //  done...
+            if(NodeType * const ExistingNode = SeekInsertionPoint(Key, UpdatedPointers))
+            {
+                ExistingNode->SetValue(std::move(Value));
+                MarkChanged(ExistingNode, UpdatedPointers);
+            }
+
+            // Otherwise the key does not exist and we need to insert a new
+            //  node...
+            else
+                LinkNewNode(
+                    UpdatedPointers, GetRandomLevel(), std::move(Key), std::move(Value));
+        }
+
+        // Insert the given key of another type and value if no equivalent key
+        //  exists, or update its value if it does, unless the list allows
+        //  duplicate keys, as above. The key is only converted
+        //  to the list's key type if it must be inserted. Only available if
+        //  the comparison object is transparent...
+        template
+        <
+            typename OtherKeyType,
+            typename ComparisonType = LessThanComparisonType,
+            typename = typename ComparisonType::is_transparent
+        >
+        void Insert(const OtherKeyType &Key, ValueType Value)
+        {
+            // Count this insertion...
+            OperationScopeType Scope(m_Statistics, SkipListOperation::Insert);
+
+            // Vector of forward pointers to maintain, as above...
+            typename NodeType::ForwardPointersType
+                UpdatedPointers;
+
+            // This node has the given key, so update its value and we're
+            //  done...
+            if(NodeType * const ExistingNode = SeekInsertionPoint(Key, UpdatedPointers))
+            {
+                ExistingNode->SetValue(std::move(Value));
+                MarkChanged(ExistingNode, UpdatedPointers);
+            }
+
+            // Otherwise construct the key within the new node...
+            else
+                LinkNewNode(
+                    UpdatedPointers,
+                    GetRandomLevel(),
+                    std::piecewise_construct,
+                    std::forward_as_tuple(Key),
+                    std::forward_as_tuple(std::move(Value)));
+        }
+
+        // Insert the given key and value if it does not exist, or update its
+        //  value if it does, unless the list allows duplicate keys, as above,
+        //  returning an iterator to it. The hint should refer to the key the
+        //  new one is expected to immediately follow,
+        //  such as the iterator returned by the previous insertion, or the end
+        //  to append. A correct hint avoids searching down from the header for
+        //  every level the hint's own node participates in. Any levels above
+        //  those are searched for from where the previous hinted insertion
+        //  left off, if nothing else has changed the list since and it was
+        //  before this key, so a run of them takes expected constant time
+        //  each. An incorrect hint is harmless, but no faster than an
+        //  ordinary insertion...
+        iterator Insert(const const_iterator Hint, KeyType Key, ValueType Value)
+        {
+            // Count this insertion...
+            OperationScopeType Scope(m_Statistics, SkipListOperation::Insert);
+
+            // Vector of forward pointers to maintain, as above...
+            typename NodeType::ForwardPointersType
+                UpdatedPointers;
+
+            // Node the key is expected to follow. The end refers to the last
+            //  node in the list, which is the header if there are none...
+            NodeType * const HintNode =
+                Hint.m_CurrentNode ? Hint.m_CurrentNode : m_RightmostNodes[0];
+
+            // The hint is correct if its node is not greater than the key or
+            //  the header, and the node following it is not less. With
+            //  duplicates, that node must be greater, since the key belongs
+            //  after any equivalent ones...
+            NodeType * const NextNode = HintNode->GetForwardPointer(0);
+            if((HintNode == m_Header || !IsLessThan(Key, HintNode->GetKey())) &&
+               (!NextNode || !IsBefore<TraitsType::DuplicateKeys>(NextNode->GetKey(), Key)))
+            {
+                // Without duplicates, if the hint itself has the given key,
+                //  update its value...
+                if(!TraitsType::DuplicateKeys &&
+                   HintNode != m_Header && !IsLessThan(HintNode->GetKey(), Key))
+                {
+                    HintNode->SetValue(std::move(Value));
+                    MarkChanged(HintNode);
+                    return MakeIterator(HintNode);
+                }
+
+                // Likewise if the node following the hint has it...
+                if(!TraitsType::DuplicateKeys &&
+                   NextNode && !IsLessThan(Key, NextNode->GetKey()))
+                {
+                    NextNode->SetValue(std::move(Value));
+                    MarkChanged(NextNode);
+                    return MakeIterator(NextNode);
+                }
+
+                // The key belongs at the tail, so the rightmost node on each
+                //  level is the node to its left...
+                if(!NextNode)
+                {
+                    UpdatedPointers = m_RightmostNodes;
+                    return MakeIterator(LinkNewNode(
+                        UpdatedPointers, GetRandomLevel(), std::move(Key), std::move(Value)));
+                }
+
+                // Whether the finger left by the previous hinted insertion is
+                //  still valid and before the key, so searching from it
+                //  wouldn't need to move left...
+                const bool FingerBefore = m_HintFingerValid &&
+                    ((m_HintFinger[0] == m_Header) ||
+                     IsBefore<TraitsType::DuplicateKeys>(m_HintFinger[0]->GetKey(), Key));
+
+                // The key belongs immediately after the hint, so the hint is
+                //  the node to its left on every level it participates in. If
+                //  the new node reaches no higher, and the list has no widths
+                //  or changes to maintain above it, that's all we need. A
+                //  finger before it is left valid...
+                const int NewLevel = GetRandomLevel();
+                if(!TraitsType::Indexable && !TraitsType::Checkpoints &&
+                   (NewLevel < HintNode->GetLevel()))
+                {
+                    std::fill_n(UpdatedPointers.begin(), NewLevel + 1, HintNode);
+                    NodeType * const NewNode = LinkNewNode(
+                        UpdatedPointers, NewLevel, std::move(Key), std::move(Value));
+                    m_HintFingerValid = FingerBefore;
+                    return MakeIterator(NewNode);
+                }
+
+                // Otherwise climb from the finger only as far as the distance
+                //  from the previous hinted key requires, or descend from the
+                //  header if we can't, then link in the new node after the
+                //  finger, which it leaves valid for a following key...
+                if(!FingerBefore)
+                {
+                    m_HintFinger.fill(m_Header);
+                    m_HintFingerRanks.fill(0);
+                }
+                SeekFromFinger<TraitsType::DuplicateKeys>(Key, m_HintFinger, &m_HintFingerRanks);
+                NodeType * const NewNode = CreateNode(NewLevel + 1, std::move(Key), std::move(Value));
+                LinkNode(m_HintFinger, NewNode, &m_HintFingerRanks);
+                m_HintFingerValid = true;
+                return MakeIterator(NewNode);
+            }
+
+            // Otherwise the hint was wrong, so fall back to an ordinary
+            //  search. If this node has the given key, update its value and
+            //  we're done...
+            if(NodeType * const ExistingNode = SeekInsertionPoint(Key, UpdatedPointers))
+            {
+                ExistingNode->SetValue(std::move(Value));
+                MarkChanged(ExistingNode, UpdatedPointers);
+                return MakeIterator(ExistingNode);
+            }
+
+            // Otherwise insert a new node...
+            return MakeIterator(LinkNewNode(
+                UpdatedPointers, GetRandomLevel(), std::move(Key), std::move(Value)));
+        }
+
+        // Insert each of the given key value pairs, which must be sorted by
+        //  key, or update its value where the key already exists, with the
+        //  last value winning for runs of equal keys. If the list allows
+        //  duplicate keys, each is inserted after any equivalent ones
+        //  instead. Each key's predecessors
+        //  on every level, and in indexable lists their ranks, are kept as a
+        //  finger for the next, so a search need only climb as high as the
+        //  distance between them requires instead of descending from the top
+        //  of the header. If inserting any pair throws, those before it
+        //  remain inserted...
+        template <typename InputIteratorType>
+        void InsertBatch(InputIteratorType First, const InputIteratorType Last)
+        {
+            // The rightmost node on each level less than the previous key, and
+            //  its rank. To begin with, this is the header on every level...
+            typename NodeType::ForwardPointersType Predecessors;
+            Predecessors.fill(m_Header);
+            std::array<size_type, MaximumLevels> Ranks{};
+
+            // Insert or update each. Neither moves any node to the left of its
+            //  key, so the finger remains valid...
+            for(; First != Last; ++First)
+            {
+                // Count this insertion...
+                OperationScopeType Scope(m_Statistics, SkipListOperation::Insert);
+
+                // Key value pair to insert, whose key must not be less than
+                //  the previous...
+                auto &&KeyValue = *First;
+                assert((Predecessors[0] == m_Header) ||
+                       IsBefore<TraitsType::DuplicateKeys>(Predecessors[0]->GetKey(), KeyValue.first));
+
+                // If this key exists already, then just update its value. With
+                //  duplicates, the finger holds the nodes not greater than it
+                //  instead, and any following node is greater...
+                NodeType * const NextNode =
+                    SeekFromFinger<TraitsType::DuplicateKeys>(KeyValue.first, Predecessors, &Ranks)
+                        ->GetForwardPointer(0);
+                if(!TraitsType::DuplicateKeys && NextNode && IsMatch(NextNode->GetKey(), KeyValue.first))
+                {
+                    NextNode->SetValue(std::forward<decltype(KeyValue)>(KeyValue).second);
+                    MarkChanged(NextNode, Predecessors);
+                    continue;
+                }
+
+                // Otherwise link in a new node after its predecessors...
+                NodeType * const NewNode = CreateNode(
+                    GetRandomLevel() + 1, std::forward<decltype(KeyValue)>(KeyValue));
+                LinkNode(Predecessors, NewNode, &Ranks);
+            }
+        }
+
+        // Move every key value pair of another list, none of whose keys may
+        //  fall between our first and last, on to whichever end of this one
+        //  they belong. Only the pointers at the boundary are relinked, so
+        //  this takes time proportional to the number of levels, unless the
+        //  list keeps checkpoints. Then each of the other's nodes is marked
+        //  as new to us. The other list is left empty. Requires the
+        //  allocator to support Absorb(). Throws std::invalid_argument if
+        //  the lists overlap, leaving both as they were...
+        void Join(SkipList &&Other)
+        {
+            // Nothing to do...
+            if((&Other == this) || (Other.m_Size == 0))
+                return;
+
+            // The other's keys must come entirely after or before ours...
+            const bool IsAfter = (m_Size == 0) ||
+                IsLessThan(m_RightmostNodes[0]->GetKey(), Other.m_Header->GetForwardPointer(0)->GetKey());
+            if(!IsAfter && !IsLessThan(Other.m_RightmostNodes[0]->GetKey(), m_Header->GetForwardPointer(0)->GetKey()))
+                throw std::invalid_argument("Lists to join must not overlap");
+
+            // Every one of the other's nodes is new to us, on all of its
+            //  levels...
+            if constexpr(TraitsType::Checkpoints)
+            {
+                for(NodeType *CurrentNode = Other.m_Header->GetForwardPointer(0); CurrentNode;
+                    CurrentNode = CurrentNode->GetForwardPointer(0))
+                {
+                    for(int CurrentLevel = 0; CurrentLevel < CurrentNode->GetLevel(); ++CurrentLevel)
+                        CurrentNode->MarkChanged(CurrentLevel);
+                }
+            }
+
+            // If they come before ours, trade nodes with the other list so
+            //  that ours are the ones appended. Each list's header and the
+            //  bookkeeping describing its nodes go together, while the nodes
+            //  all end up our allocator's either way...
+            if(!IsAfter)
+            {
+                std::swap(m_Header, Other.m_Header);
+                std::swap(m_RightmostNodes, Other.m_RightmostNodes);
+                std::swap(m_HighestLevel, Other.m_HighestLevel);
+                std::swap(m_Size, Other.m_Size);
+                std::swap(m_TowerLevels, Other.m_TowerLevels);
+            }
+
+            // Append the other's nodes to ours...
+            Append(Other);
+        }
+
+        // Retrieve an iterator to the last key value pair in constant time, or
+        //  the end if the list is empty...
+        iterator Last() const noexcept
+        {
+            return (m_RightmostNodes[0] != m_Header)
+                ? MakeIterator(m_RightmostNodes[0]) : end();
+        }
+
+        // Find the first key value pair whose key is not less than the given
+        //  key, returning the end if there isn't one...
+        template <typename OtherKeyType>
+        iterator LowerBound(const OtherKeyType &Key) const
+        {
+            const LookupKeyType<OtherKeyType> &LookupKey = Key;
+            return MakeIterator(SeekPredecessor(LookupKey)->GetForwardPointer(0));
+        }
+
+        // Visit every key value pair from the lower bound of the given key to
+        //  the end of the list, as described for Range(). Return the number
+        //  visited...
+        template <typename OtherKeyType, typename VisitorType>
+        size_type LowerBound(const OtherKeyType &Key, VisitorType &&Visitor) const
+        {
+            return VisitNodes(LowerBound(Key).m_CurrentNode, nullptr, Visitor);
+        }
+
+        // Get a view over the key value pairs whose keys are not less than the
+        //  lower key and less than the upper key. Only a single descent is
+        //  performed to find the first pair, after which the view streams
+        //  along the bottom level until a key reaches the upper key...
+        template <typename LowerKeyType, typename UpperKeyType>
+        auto Range(
+            const LowerKeyType &LowerKey,
+            const UpperKeyType &UpperKey) const
+        {
+            return RangeType<std::decay_t<LookupKeyType<UpperKeyType>>>(
+                *this, LowerBound(LowerKey).m_CurrentNode, UpperKey);
+        }
+
+        // Visit every key value pair whose key is not less than the lower key
+        //  and less than the upper key, in order, without constructing any
+        //  iterators. The visitor is called with each key value pair, and if
+        //  it returns a boolean, visiting stops when it returns false. Return
+        //  the number visited...
+        template <typename LowerKeyType, typename UpperKeyType, typename VisitorType>
+        size_type Range(
+            const LowerKeyType &LowerKey,
+            const UpperKeyType &UpperKey,
+            VisitorType &&Visitor) const
+        {
+            // Upper key to compare with...
+            const LookupKeyType<UpperKeyType> &LookupUpperKey = UpperKey;
+
+            // Visit each node from the lower bound until one reaches the
+            //  upper key...
+            size_type Visited = 0;
+            for(const NodeType *CurrentNode = LowerBound(LowerKey).m_CurrentNode;
+                CurrentNode && IsLessThan(CurrentNode->GetKey(), LookupUpperKey);
+                CurrentNode = CurrentNode->GetForwardPointer(0))
+            {
+                // Count it and stop if the visitor asks...
+              ++Visited;
+                if(!Visit(Visitor, CurrentNode->GetKeyValue()))
+                    break;
+            }
+
+            // Return the number visited...
+            return Visited;
+        }
+
+        // Break down the memory the list occupies, from counters kept as nodes
+        //  come and go, in constant time...
+        SkipListMemoryUsage MemoryUsage() const noexcept
+        {
+            // Bytes of each part of a node, besides its tower...
+            constexpr std::size_t NodeHeaderSize =
+                sizeof(NodeType) - sizeof(KeyValueType);
+            constexpr std::size_t PointerSize = sizeof(NodeType *);
+            constexpr std::size_t WidthSize = NodeType::WidthSize;
+
+            // Levels in every tower, including the header's...
+            const std::size_t Levels = m_TowerLevels + m_Header->GetLevel();
+
+            // Break it down. The header's unused key and value are overhead
+            //  like the rest of it...
+            SkipListMemoryUsage Usage;
+            Usage.NodeHeaders       = (m_Size * NodeHeaderSize) + sizeof(NodeType);
+            Usage.ForwardPointers   = Levels * PointerSize;
+            Usage.Widths            = Levels * WidthSize;
+            Usage.Payloads          = m_Size * sizeof(KeyValueType);
+            Usage.ListObject        = sizeof(*this);
+
+            // Whatever the allocator holds that the nodes it gave us don't
+            //  occupy, if it tells us. It never gave us the header...
+            if constexpr(HasReservedBytes)
+            {
+                const std::size_t NodeBytes =
+                    (m_Size * sizeof(NodeType)) + (m_TowerLevels * (PointerSize + WidthSize));
+                assert(m_Allocator.GetReservedBytes() >= NodeBytes);
+                Usage.AllocatorSlack = m_Allocator.GetReservedBytes() - NodeBytes;
+            }
+
+            // Return the breakdown...
+            return Usage;
+        }
+
+        // Move every key value pair of another list into this one in a single
+        //  linear pass over both, splicing its nodes in rather than copying
+        //  them. Where both lists hold a key, the other's value wins, as it
+        //  would had it been inserted, and it's our node that is released.
+        //  If the list allows duplicate keys, both are kept instead, with
+        //  ours first. The other list is left empty. Requires the allocator to support
+        //  Absorb(), and if that throws neither list has changed...
+        void Merge(SkipList &&Other)
+        {
+            // Nothing to do...
+            if((&Other == this) || (Other.m_Size == 0))
+                return;
+
+            // We now answer for the other's nodes, and will be at least as
+            //  tall as either list. Any finger a hinted insertion left no
+            //  longer is valid...
+            m_Allocator.Absorb(Other.m_Allocator);
+            m_HintFingerValid = false;
+            m_TowerLevels += Other.m_TowerLevels;
+            m_HighestLevel = std::max(m_HighestLevel, Other.m_HighestLevel);
+
+            // Rightmost node relinked so far on each level, and its rank,
+            //  counting the header as zero...
+            typename NodeType::ForwardPointersType Rightmost;
+            Rightmost.fill(m_Header);
+            std::array<size_type, MaximumLevels> Ranks{};
+            size_type Rank = 0;
+
+            // Walk both bottom levels together, relinking whichever node comes
+            //  first after the rightmost on each level it participates in...
+            NodeType *OurNode   = m_Header->GetForwardPointer(0);
+            NodeType *OtherNode = Other.m_Header->GetForwardPointer(0);
+            while(OurNode || OtherNode)
+            {
+                // Take the lesser of the two, remembering what follows it. If
+                //  they're equal, take the other's and release ours, or with
+                //  duplicates, take ours first...
+                NodeType *Node = nullptr;
+                bool Changed = true;
+                if(!OtherNode || (OurNode &&
+                    IsBefore<TraitsType::DuplicateKeys>(OurNode->GetKey(), OtherNode->GetKey())))
+                {
+                    Node = std::exchange(OurNode, OurNode->GetForwardPointer(0));
+                    Changed = false;
+                }
+                else
+                {
+                    if(OurNode && !IsLessThan(OtherNode->GetKey(), OurNode->GetKey()))
+                        DestroyNode(std::exchange(OurNode, OurNode->GetForwardPointer(0)));
+                    Node = std::exchange(OtherNode, OtherNode->GetForwardPointer(0));
+                }
+
+                // Append it on each of its levels. The node it follows now
+                //  skips exactly to it...
+              ++Rank;
+                Node->SetBackPointer(Rightmost[0]);
+                for(int CurrentLevel = 0; CurrentLevel < Node->GetLevel(); ++CurrentLevel)
+                {
+                    Rightmost[CurrentLevel]->SetForwardPointer(CurrentLevel, Node);
+                    if constexpr(TraitsType::Indexable)
+                    {
+                        Rightmost[CurrentLevel]->SetWidth(CurrentLevel, Rank - Ranks[CurrentLevel]);
+                        Ranks[CurrentLevel] = Rank;
+                    }
+                    Rightmost[CurrentLevel] = Node;
+                }
+
+                // Each of the other list's nodes is new to us...
+                if(Changed)
+                    MarkChanged(Node, Rightmost);
+            }
+
+            // Terminate each level, whose last node now skips to one past the
+            //  end...
+            for(int CurrentLevel = 0; CurrentLevel <= m_HighestLevel; ++CurrentLevel)
+            {
+                Rightmost[CurrentLevel]->SetForwardPointer(CurrentLevel, nullptr);
+                if constexpr(TraitsType::Indexable)
+                    Rightmost[CurrentLevel]->SetWidth(CurrentLevel, Rank + 1 - Ranks[CurrentLevel]);
+            }
+            m_RightmostNodes = Rightmost;
+            UpdateBackPointer(Rightmost[0]);
+            m_Size = Rank;
+
+            // If ours were the only nodes on the highest levels and the other
+            //  list held their keys too, then those levels are empty now...
+            TrimHighestLevel();
+
+            // The other list no longer holds any nodes...
+            Other.ResetHeader();
+        }
+
+        // Append a range of key value pairs, sorted by key, to the end of the
+        //  list exactly as BulkLoad() would, but splitting the range into
+        //  pieces built as separate lists on up to the given number of
+        //  threads, or one per hardware thread if zero, before joining them on
+        //  to the end of this one. Each piece draws its levels from its own
+        //  level generator, seeded from ours, and any piece that throws
+        //  has its exception rethrown here once every thread is done.
+        //  Requires the allocator to support Absorb()...
+        template <typename RandomAccessIteratorType>
+        void ParallelBulkLoad(
+            const RandomAccessIteratorType First,
+            const RandomAccessIteratorType Last,
+            const SkipListLevelAssignment LevelAssignment = SkipListLevelAssignment::Random,
+            unsigned int ThreadCount = 0)
+        {
+            // Decide how many pieces it's worth splitting the range into, so
+            //  that each is large enough to be worth a thread...
+            const size_type Count = static_cast<size_type>(std::distance(First, Last));
+            if(ThreadCount == 0)
+                ThreadCount = std::max(std::thread::hardware_concurrency(), 1u);
+            const size_type Pieces = std::max<size_type>(
+                std::min<size_type>(ThreadCount, Count / ParallelGrainSize), 1);
+
+            // Not worth it...
+            if(Pieces == 1)
+            {
+                BulkLoad(First, Last, LevelAssignment);
+                return;
+            }
+
+            // Find where each piece begins. Runs of equal keys, including any
+            //  equal to our own last, are never split so that only the first
+            //  piece can meet a key already loaded...
+            std::vector<RandomAccessIteratorType> Bounds(Pieces + 1, First);
+            Bounds[Pieces] = Last;
+            for(size_type Piece = 1; Piece < Pieces; ++Piece)
+            {
+                RandomAccessIteratorType Bound = std::max(
+                    Bounds[Piece - 1], First + static_cast<std::ptrdiff_t>((Count / Pieces) * Piece));
+                while((Bound != Last) && (Bound != First) &&
+                      (!IsLessThan((Bound - 1)->first, Bound->first) ||
+                       ((m_Size != 0) && !IsLessThan(m_RightmostNodes[0]->GetKey(), Bound->first))))
+                    ++Bound;
+                Bounds[Piece] = Bound;
+            }
+
+            // Every piece but the first is built as a list of its own, with
+            //  its balanced levels counted from where it lands in ours...
+            std::vector<std::unique_ptr<SkipList>> Sublists;
+            for(size_type Piece = 1; Piece < Pieces; ++Piece)
+                Sublists.push_back(std::make_unique<SkipList>(
+                    m_LessThanComparison, GetSiblingAllocator(), GetSiblingLevelGenerator()));
+
+            // Build each of those pieces on a thread of its own, and the first
+            //  directly into this list on this one...
+            std::vector<std::exception_ptr> Errors(Pieces);
+            std::vector<std::thread> Threads;
+            const size_type PositionBase = m_Size;
+            const auto BuildPiece = [&](const size_type Piece) noexcept
+            {
+                try
+                {
+                    SkipList &Target = Piece ? *Sublists[Piece - 1] : *this;
+                    Target.AppendSorted(
+                        Bounds[Piece],
+                        Bounds[Piece + 1],
+                        LevelAssignment,
+                        Piece ? PositionBase + static_cast<size_type>(Bounds[Piece] - First) : 0);
+                }
+                catch(...)
+                {
+                    Errors[Piece] = std::current_exception();
+                }
+            };
+            try
+            {
+                for(size_type Piece = 1; Piece < Pieces; ++Piece)
+                    Threads.emplace_back(BuildPiece, Piece);
+            }
+            catch(...)
+            {
+                for(std::thread &Thread : Threads)
+                    Thread.join();
+                throw;
+            }
+            BuildPiece(0);
+            for(std::thread &Thread : Threads)
+                Thread.join();
+
+            // Throw the first error, if any...
+            for(const std::exception_ptr &Error : Errors)
+            {
+                if(Error)
+                    std::rethrow_exception(Error);
+            }
+
+            // Join each piece on to the end in order...
+            for(const std::unique_ptr<SkipList> &Sublist : Sublists)
+                Append(*Sublist);
+        }
+
+        // Count the keys less than the given key in logarithmic time, which is
+        //  the zero based position the key has, or would have if inserted.
+        //  Only available if the list is indexable...
+        template <typename OtherKeyType>
+        size_type Rank(const OtherKeyType &Key) const
+        {
+            static_assert(TraitsType::Indexable, "Rank() requires an indexable skip list");
+            const LookupKeyType<OtherKeyType> &LookupKey = Key;
+            return CountBefore(LookupKey);
+        }
+
+        // Reset every counter kept for the statistics. Only available if the
+        //  list keeps statistics...
+        void ResetStatistics() noexcept
+        {
+            static_assert(TraitsType::Statistics, "ResetStatistics() requires a skip list keeping statistics");
+            m_Statistics = StatisticsCountersType();
+        }
+
+        // Search for the given key, returning an iterator to its key value pair
+        //  if found, or the end if not...
+        iterator Search(const KeyType &SearchKey) const noexcept
+        {
+            // Return an iterator to the node with the key, which is the end if
+            //  it wasn't found...
+            return MakeIterator(FindNode(SearchKey));
+        }
+
+        // Search for the key equivalent to the given one of another type,
+        //  returning an iterator to its key value pair if found, or the end if
+        //  not. Only available if the comparison object is transparent...
+        template
+        <
+            typename OtherKeyType,
+            typename ComparisonType = LessThanComparisonType,
+            typename = typename ComparisonType::is_transparent
+        >
+        iterator Search(const OtherKeyType &SearchKey) const noexcept
+        {
+            // Return an iterator to the node with the key, which is the end if
+            //  it wasn't found...
+            return MakeIterator(FindNode(SearchKey));
+        }
+
+        // Write every key value pair in order to the given sink as a single
+        //  unbounded range, in chunks of about the given size, each prefixed
+        //  by its length, without ever holding more than one chunk. Keys and
+        //  values are encoded by SkipListCodec. The sink is called as follows
+        //  with each run of bytes...
+        //
+        //      void Sink(const void *Bytes, std::size_t Size);
+        //
+        template <typename SinkType>
+        void Serialize(SinkType &&Sink, const std::size_t ChunkBytes = 64 * 1024) const
+        {
+            // Write the whole list as one range...
+            StreamWriterType<std::remove_reference_t<SinkType>> Writer(Sink, ChunkBytes);
+            Writer.BeginRange(nullptr, nullptr, m_Size);
+            for(const NodeType *CurrentNode = m_Header->GetForwardPointer(0);
+                CurrentNode;
+                CurrentNode = CurrentNode->GetForwardPointer(0))
+                Writer.WriteKeyValue(CurrentNode->GetKeyValue());
+            Writer.Finish();
+        }
+
+        // Write, as above, only the ranges of keys changed since the last
+        //  call, or since the list was constructed, then forget them. Each
+        //  range is bounded by the keys either side of it that didn't change,
+        //  and holds its current key value pairs, so applying it with
+        //  Deserialize() to a list holding the previous checkpoint repeats
+        //  every insertion, update, and deletion in between. Changed ranges
+        //  are found by descending only into spans marked as holding changes,
+        //  so the cost is in proportion to the changes rather than the whole
+        //  list. Values modified in place through an iterator aren't seen as
+        //  changes, so update them with Insert() instead. If the sink throws,
+        //  every change is still remembered for the next call. Only available
+        //  if the list keeps checkpoints...
+        template <typename SinkType>
+        void SerializeChanges(SinkType &&Sink, const std::size_t ChunkBytes = 64 * 1024)
+        {
+            static_assert(TraitsType::Checkpoints, "SerializeChanges() requires a skip list keeping checkpoints");
+
+            // Write each changed range...
+            StreamWriterType<std::remove_reference_t<SinkType>> Writer(Sink, ChunkBytes);
+            const NodeType *WrittenUntil = m_Header;
+            WriteChanges(Writer, m_Header, m_HighestLevel, nullptr, WrittenUntil);
+            Writer.Finish();
+
+            // Only once they're all written, forget them...
+            ForgetChanges(m_Header, m_HighestLevel, nullptr);
+        }
+
+        // Search for every key in the given range, writing an iterator for
+        //  each to the output in the same order, pointing to its key value
+        //  pair if found or the end if not. While the keys are sorted, each
+        //  search resumes from the previous key's position on every level
+        //  instead of starting again from the header. From the first key out
+        //  of order, several searches are interleaved so that their cache
+        //  misses overlap. The keys are visited in a single pass, but must
+        //  be given by forward iterators since several may be in flight at
+        //  once. They may be of any type the lookups accept. Returns the
+        //  output iterator one past the last written...
+        template <typename KeyIteratorType, typename OutputIteratorType>
+        OutputIteratorType SearchBatch(
+            const KeyIteratorType KeysBegin,
+            const KeyIteratorType KeysEnd,
+            OutputIteratorType Output) const
+        {
+            return SearchSortedBatch(KeysBegin, KeysEnd, Output);
+        }
+
+        // Move every key value pair whose key is not less than the given key
+        //  into a new list, which is returned. Only the pointers at the
+        //  boundary are relinked, which takes logarithmic time, though the
+        //  moved nodes are still visited once to count them, and their
+        //  levels, so each list can account for its own. Nothing is copied or
+        //  reallocated. Requires the allocator to support Share() and
+        //  Transfer()...
+        template <typename OtherKeyType>
+        SkipList SplitAt(const OtherKeyType &Key)
+        {
+            const LookupKeyType<OtherKeyType> &LookupKey = Key;
+            return SkipList(SplitTagType(), *this, LookupKey);
+        }
+
+        // Insert the given key with a value constructed in place from the
+        //  remaining arguments if the key does not already exist. Otherwise
+        //  leave the existing value untouched and construct nothing. Return an
+        //  iterator to the key value pair with that key and whether a new pair
+        //  was inserted. If the list allows duplicate keys, as Emplace()...
+        template <typename... ArgumentTypes>
+        std::pair<iterator, bool> TryEmplace(const KeyType &Key, ArgumentTypes &&... Arguments)
+        {
+            return TryEmplaceKey(Key, std::forward<ArgumentTypes>(Arguments)...);
+        }
+
+        // As above, but moving the key into the new node...
+        template <typename... ArgumentTypes>
+        std::pair<iterator, bool> TryEmplace(KeyType &&Key, ArgumentTypes &&... Arguments)
+        {
+            return TryEmplaceKey(std::move(Key), std::forward<ArgumentTypes>(Arguments)...);
+        }
+
+        // As above, but for a key of another type which is only converted to
+        //  the list's key type if it must be inserted. Only available if the
+        //  comparison object is transparent...
+        template
+        <
+            typename OtherKeyType,
+            typename... ArgumentTypes,
+            typename ComparisonType = LessThanComparisonType,
+            typename = typename ComparisonType::is_transparent,
+            typename = std::enable_if_t<
+                !std::is_convertible_v<OtherKeyType &&, const KeyType &>>
+        >
+        std::pair<iterator, bool> TryEmplace(OtherKeyType &&Key, ArgumentTypes &&... Arguments)
+        {
+            return TryEmplaceKey(
+                std::forward<OtherKeyType>(Key), std::forward<ArgumentTypes>(Arguments)...);
+        }
+
+        // Find the first key value pair whose key is greater than the given
+        //  key, returning the end if there isn't one...
+        template <typename OtherKeyType>
+        iterator UpperBound(const OtherKeyType &Key) const
+        {
+            const LookupKeyType<OtherKeyType> &LookupKey = Key;
+            return MakeIterator(SeekPredecessor<true>(LookupKey)->GetForwardPointer(0));
+        }
+
+        // Visit every key value pair from the upper bound of the given key to
+        //  the end of the list, as described for Range(). Return the number
+        //  visited...
+        template <typename OtherKeyType, typename VisitorType>
+        size_type UpperBound(const OtherKeyType &Key, VisitorType &&Visitor) const
+        {
+            return VisitNodes(UpperBound(Key).m_CurrentNode, nullptr, Visitor);
+        }
+
+        // Update the value of the given key in place by calling the given
+        //  function with a reference to it. If the key doesn't exist, the
+        //  function is called on a value initialised value instead, which is
+        //  then inserted with the key. Either way the list is searched only
+        //  once, unlike a search followed by an insertion, and if the
+        //  function throws, nothing is inserted. If the list allows
+        //  duplicate keys, the last pair with the key is the one updated.
+        //  Return an iterator to the key value pair with that key and
+        //  whether a new pair was inserted...
+        template <typename FunctionType>
+        std::pair<iterator, bool> Upsert(KeyType Key, FunctionType &&Update)
+        {
+            // Count this insertion...
+            OperationScopeType Scope(m_Statistics, SkipListOperation::Insert);
+
+            // Find where the key belongs. With duplicates, the node on its
+            //  left is the last with the key, if any...
+            typename NodeType::ForwardPointersType UpdatedPointers;
+            NodeType *ExistingNode = SeekInsertionPoint(Key, UpdatedPointers);
+            if constexpr(TraitsType::DuplicateKeys)
+            {
+                if(UpdatedPointers[0] != m_Header && !IsLessThan(UpdatedPointers[0]->GetKey(), Key))
+                    ExistingNode = UpdatedPointers[0];
+            }
+
+            // It exists, so update its value where it is...
+            if(ExistingNode)
+            {
+                Update(ExistingNode->GetKeyValue().second);
+                MarkChanged(ExistingNode, UpdatedPointers);
+                return {MakeIterator(ExistingNode), false};
+            }
+
+            // Otherwise prepare its value before inserting it...
+            ValueType Value{};
+            Update(Value);
+            return {MakeIterator(LinkNewNode(
+                UpdatedPointers, GetRandomLevel(), std::move(Key), std::move(Value))), true};
+        }
+
+        // Destructor...
+       ~SkipList()
+        {
+            // Release every node after the header...
+            DestroyNodes();
+
+            // Release the header node itself...
+            DestroySentinelNode(m_Header);
+        }
+
+    // Protected types...
+    protected:
+
+        // Node's backward pointer on the bottom level, for lists that keep
+        //  them...
+        struct BackPointerType
+        {
+            // Node on the left, which is the header for the first node. The
+            //  header's own is the tail, or itself when the list is empty...
+            NodeType   *m_BackPointer = nullptr;
+        };
+
+        // Empty base for nodes in lists without back pointers, which costs
+        //  nothing...
+        struct NoBackPointerType {};
+
+        // Mask of levels on which the span beginning at a node holds a change
+        //  since the last checkpoint, for lists that keep them. On the bottom
+        //  level, that's the node itself or the gap after it...
+        struct ChangedLevelsType
+        {
+            std::conditional_t<(MaximumLevels <= 32), std::uint32_t, std::uint64_t>
+                        m_ChangedLevels = 0;
+        };
+
+        // Empty base for nodes in lists without checkpoints...
+        struct NoChangedLevelsType {};
+
+        // Tag selecting the header's constructor...
+        struct SentinelTagType {};
+
+        // Tag selecting the constructor that splits another list...
+        struct SplitTagType {};
+
+        // Counters behind the statistics, for lists that keep them...
+        struct StatisticsCountersType
+        {
+            // Count a call to the comparison object...
+            void CountComparison() noexcept { ++m_Comparisons; }
+
+            // Count a step right along the given level of a search path...
+            void CountHop(const int Level) noexcept { ++m_Hops[Level]; ++m_Steps; }
+
+            // Count a level examined along a search path...
+            void CountLevel() noexcept { ++m_Steps; }
+
+            // Count the given operation, which began when the search path
+            //  step count was as given...
+            void CountOperation(const SkipListOperation Operation, const std::uint64_t StepsBefore) noexcept
+            {
+              ++m_Operations[static_cast<std::size_t>(Operation)];
+                m_PathLengths[static_cast<std::size_t>(Operation)] += m_Steps - StepsBefore;
+            }
+
+            // Get the total search path steps so far...
+            std::uint64_t GetSteps() const noexcept { return m_Steps; }
+
+            // Counters, as described for the statistics snapshot...
+            std::uint64_t                                   m_Comparisons = 0;
+            std::array<std::uint64_t, MaximumLevels>        m_Hops{};
+            std::uint64_t                                   m_Steps = 0;
+            decltype(SkipListStatistics::Operations)        m_Operations{};
+            decltype(SkipListStatistics::PathLengths)       m_PathLengths{};
+        };
+
+        // Counters for lists without statistics, which count nothing and cost
+        //  nothing...
+        struct NoStatisticsCountersType
+        {
+            void CountComparison() noexcept {}
+            void CountHop(int) noexcept {}
+            void CountLevel() noexcept {}
+            void CountOperation(SkipListOperation, std::uint64_t) noexcept {}
+            std::uint64_t GetSteps() const noexcept { return 0; }
+        };
+
+        // Counters kept by this list...
+        using CountersType = std::conditional_t<
+            TraitsType::Statistics, StatisticsCountersType, NoStatisticsCountersType>;
+
+        // Counts one operation and the length of its search path over its
+        //  lifetime...
+        class OperationScopeType
+        {
+            // Public methods...
+            public:
+
+                // Constructor begins counting the given operation...
+                OperationScopeType(CountersType &Counters, const SkipListOperation Operation) noexcept
+                  : m_Counters(Counters),
+                    m_Operation(Operation),
+                    m_StepsBefore(Counters.GetSteps())
+                {
+                }
+
+                // Destructor counts it...
+               ~OperationScopeType() { m_Counters.CountOperation(m_Operation, m_StepsBefore); }
+
+            // Protected attributes...
+            protected:
+
+                // Counters to add to...
+                CountersType               &m_Counters;
+
+                // Operation counted...
+                const SkipListOperation     m_Operation;
+
+                // Search path steps counted before it began...
+                const std::uint64_t         m_StepsBefore;
+        };
+
+        // Writes a serialised stream of ranges of key value pairs to a sink, in
+        //  chunks of about the given size, each prefixed by its length. No
+        //  range's bounds or key value pair straddle chunks, so each can be
+        //  decoded as soon as its chunk is read...
+        template <typename SinkType>
+        class StreamWriterType
+        {
+            // Public methods...
+            public:
+
+                // Constructor writes the stream's signature...
+                StreamWriterType(SinkType &Sink, const std::size_t ChunkBytes)
+                  : m_Sink(Sink),
+                    m_ChunkBytes(ChunkBytes)
+                {
+                    m_Chunk.reserve(ChunkBytes);
+                    m_Sink(static_cast<const void *>(StreamSignature), sizeof(StreamSignature));
+                }
+
+                // Begin a range with the given bounds, or unbounded where
+                //  null, holding the given number of key value pairs, which
+                //  must follow...
+                void BeginRange(
+                    const KeyType * const LowerKey,
+                    const KeyType * const UpperKey,
+                    const size_type Count)
+                {
+                    m_Record.push_back(static_cast<unsigned char>(
+                        (LowerKey ? StreamHasLowerKey : 0) | (UpperKey ? StreamHasUpperKey : 0)));
+                    if(LowerKey)
+                        SkipListCodec<KeyType>::Encode(*LowerKey, m_Record);
+                    if(UpperKey)
+                        SkipListCodec<KeyType>::Encode(*UpperKey, m_Record);
+                    SkipListVarint::Encode(Count, m_Record);
+                    Commit();
+                }
+
+                // Write the rest of the current chunk, then mark the end...
+                void Finish()
+                {
+                    Flush();
+                    const unsigned char End = 0;
+                    m_Sink(static_cast<const void *>(&End), sizeof(End));
+                }
+
+                // Write the given key value pair within the current range...
+                void WriteKeyValue(const KeyValueType &KeyValue)
+                {
+                    SkipListCodec<KeyType>::Encode(KeyValue.first, m_Record);
+                    SkipListCodec<ValueType>::Encode(KeyValue.second, m_Record);
+                    Commit();
+                }
+
+            // Protected methods...
+            protected:
+
+                // Move the encoded record into the chunk, writing the chunk
+                //  out first if the record won't fit. A record larger than a
+                //  chunk gets one to itself...
+                void Commit()
+                {
+                    if(!m_Chunk.empty() && (m_Chunk.size() + m_Record.size() > m_ChunkBytes))
+                        Flush();
+                    m_Chunk.insert(m_Chunk.end(), m_Record.cbegin(), m_Record.cend());
+                    m_Record.clear();
+                }
+
+                // Write the chunk out, prefixed by its length, if it has
+                //  anything in it...
+                void Flush()
+                {
+                    if(m_Chunk.empty())
+                        return;
+                    std::vector<unsigned char> Length;
+                    SkipListVarint::Encode(m_Chunk.size(), Length);
+                    m_Sink(static_cast<const void *>(Length.data()), Length.size());
+                    m_Sink(static_cast<const void *>(m_Chunk.data()), m_Chunk.size());
+                    m_Chunk.clear();
+                }
+
+            // Protected attributes...
+            protected:
+
+                // Where to write chunks...
+                SinkType                       &m_Sink;
+
+                // How large to let chunks grow...
+                const std::size_t               m_ChunkBytes;
+
+                // Chunk being filled, and the record being encoded...
+                std::vector<unsigned char>      m_Chunk;
+                std::vector<unsigned char>      m_Record;
+        };
+
+        // Reads a serialised stream from a source a chunk at a time, holding
+        //  no more than one chunk...
+        template <typename SourceType>
+        class StreamReaderType
+        {
+            // Public methods...
+            public:
+
+                // Constructor checks the stream's signature...
+                explicit StreamReaderType(SourceType &Source)
+                  : m_Source(Source),
+                    m_Cursor(nullptr),
+                    m_End(nullptr)
+                {
+                    unsigned char Signature[sizeof(StreamSignature)];
+                    Read(Signature, sizeof(Signature));
+                    if(!std::equal(std::begin(Signature), std::end(Signature), std::begin(StreamSignature)))
+                        throw std::runtime_error("Not a skip list stream, or an unsupported version.");
+                }
+
+                // Decode a single byte from the current chunk...
+                unsigned char DecodeByte()
+                {
+                    if(m_Cursor == m_End)
+                        throw std::runtime_error("Truncated skip list stream.");
+                    return *m_Cursor++;
+                }
+
+                // Decode a key or value from the current chunk...
+                template <typename Type>
+                Type Decode() { return SkipListCodec<Type>::Decode(m_Cursor, m_End); }
+
+                // Decode a variable length integer from the current chunk...
+                std::uint64_t DecodeVarint() { return SkipListVarint::Decode(m_Cursor, m_End); }
+
+                // Whether everything in the current chunk has been decoded...
+                bool IsChunkEnd() const noexcept { return m_Cursor == m_End; }
+
+                // Read the next chunk, returning false at the end of the
+                //  stream instead...
+                bool NextChunk()
+                {
+                    // Read its length a byte at a time...
+                    std::uint64_t Length = 0;
+                    for(unsigned Shift = 0;; Shift += 7)
+                    {
+                        unsigned char Byte;
+                        Read(&Byte, sizeof(Byte));
+                        if(Shift >= 64)
+                            throw std::runtime_error("Malformed chunk in skip list stream.");
+                        Length |= static_cast<std::uint64_t>(Byte & 0x7F) << Shift;
+                        if(!(Byte & 0x80))
+                            break;
+                    }
+
+                    // A chunk of nothing marks the end...
+                    if(!Length)
+                        return false;
+
+                    // Read the rest of it, growing the chunk only as its bytes
+                    //  arrive, so a corrupt length can't have us allocate more
+                    //  than the stream really holds...
+                    if(Length > m_Chunk.max_size())
+                        throw std::runtime_error("Malformed chunk in skip list stream.");
+                    constexpr std::size_t ReadBytes = 64 * 1024;
+                    m_Chunk.clear();
+                    while(m_Chunk.size() < Length)
+                    {
+                        const std::size_t Offset = m_Chunk.size();
+                        const std::size_t Size = static_cast<std::size_t>(
+                            std::min<std::uint64_t>(Length - Offset, ReadBytes));
+                        m_Chunk.resize(Offset + Size);
+                        Read(m_Chunk.data() + Offset, Size);
+                    }
+                    m_Cursor    = m_Chunk.data();
+                    m_End       = m_Cursor + m_Chunk.size();
+                    return true;
+                }
+
+            // Protected methods...
+            protected:
+
+                // Read exactly the given number of bytes...
+                void Read(unsigned char * const Bytes, const std::size_t Size)
+                {
+                    for(std::size_t Done = 0; Done < Size;)
+                    {
+                        const std::size_t Read = m_Source(static_cast<void *>(Bytes + Done), Size - Done);
+                        if(!Read)
+                            throw std::runtime_error("Truncated skip list stream.");
+                        Done += Read;
+                    }
+                }
+
+            // Protected attributes...
+            protected:
+
+                // Where to read chunks from...
+                SourceType                     &m_Source;
+
+                // The current chunk, and how far into it we've decoded...
+                std::vector<unsigned char>      m_Chunk;
+                const unsigned char            *m_Cursor;
+                const unsigned char            *m_End;
+        };
+
+        // Node type. Each node and its tower of forward pointers live in a
+        //  single allocation sized to the node's own height, with the tower
+        //  immediately following the node object. The majority of nodes only
+        //  participate in the lowest level or two, so they no longer pay for a
+        //  full MaximumLevels worth of pointers...
+        class alignas(KeyValueType) alignas(void *) NodeType
+          : public std::conditional_t<TraitsType::BackPointers, BackPointerType, NoBackPointerType>,
+            public std::conditional_t<TraitsType::Checkpoints, ChangedLevelsType, NoChangedLevelsType>
+        {
+            // Public types...
+            public:
+
+				// Alias for the skip list's key value type...
+				using value_type = KeyValueType;
+
+            // Public constants...
+            public:
+
+                // Whether the node keeps a backward pointer...
+                static constexpr bool HasBackPointer = TraitsType::BackPointers;
+
+                // Bytes of width kept alongside each forward pointer...
+                static constexpr std::size_t WidthSize =
+                    TraitsType::Indexable ? sizeof(size_type) : 0;
+
+            // Public methods...
+            public:
+
+                // Construct by height, with the key and value pair constructed
+                //  in place from the remaining arguments, or default
+                //  initialized if there are none...
+                template <typename... ArgumentTypes>
+                explicit NodeType(const int Height, ArgumentTypes &&... Arguments)
+                  : m_KeyValue(std::forward<ArgumentTypes>(Arguments)...),
+                    m_Height(Height)
+                {
+                    // Start with every forward pointer in the tower null, and
+                    //  their widths, if we keep them, zero...
+                    std::uninitialized_fill_n(GetForwardPointers(), m_Height, nullptr);
+                    if constexpr(TraitsType::Indexable)
+                        std::uninitialized_fill_n(GetWidths(), m_Height, size_type(0));
+                }
+
+                // Construct a header by height. A header never has a key or
+                //  value, so neither is constructed, and neither type needs to
+                //  be default constructible...
+                NodeType(SentinelTagType, const int Height) noexcept
+                  : m_Height(Height)
+                {
+                    std::uninitialized_fill_n(GetForwardPointers(), m_Height, nullptr);
+                    if constexpr(TraitsType::Indexable)
+                        std::uninitialized_fill_n(GetWidths(), m_Height, size_type(0));
+                }
+
+                // Nodes are always created in place within storage large
+                //  enough for their tower, so they can never be copied...
+                NodeType(const NodeType &) = delete;
+                NodeType &operator=(const NodeType &) = delete;
+
+                // Destructor destroys the key and value. Headers have neither,
+                //  so they're released without being destroyed...
+               ~NodeType() { m_KeyValue.~KeyValueType(); }
+
+                // Calculate the number of bytes needed to store a node with
+                //  the given height, including its tower...
+                static constexpr std::size_t GetAllocationSize(const int Height) noexcept
+                {
+                    return sizeof(NodeType) +
+                        (static_cast<std::size_t>(Height) * (sizeof(NodeType *) + WidthSize));
+                }
+
+                // Stop marking the span beginning here on the given level as
+                //  changed...
+                void ClearChanged(const int Level) noexcept
+                {
+                    static_assert(TraitsType::Checkpoints);
+                    this->m_ChangedLevels &= ~(decltype(this->m_ChangedLevels)(1) << Level);
+                }
+
+                // Get the backward pointer on the bottom level...
+                NodeType *GetBackPointer() const noexcept
+                {
+                    static_assert(HasBackPointer);
+                    return this->m_BackPointer;
+                }
+
+                // Get the forward pointer for the given level...
+                NodeType *GetForwardPointer(const int Level) const noexcept
+                {
+                    assert(Level < m_Height);
+                    return GetForwardPointers()[Level];
+                }
+
+                // Get the key...
+                const KeyType &GetKey() const noexcept { return m_KeyValue.first; }
+
+                // Get the key and value pair...
+                KeyValueType &GetKeyValue() noexcept { return m_KeyValue; }
+                const KeyValueType &GetKeyValue() const noexcept { return m_KeyValue; }
+
+                // Get the level, or the number of levels in the list this node
+                //  participates in and hence the height of its tower...
+                int GetLevel() const noexcept { return m_Height; }
+
+                // Whether the span beginning here on the given level holds a
+                //  change since the last checkpoint...
+                bool IsChanged(const int Level) const noexcept
+                {
+                    static_assert(TraitsType::Checkpoints);
+                    return (this->m_ChangedLevels >> Level) & 1;
+                }
+
+                // Mark the span beginning here on the given level as
+                //  changed...
+                void MarkChanged(const int Level) noexcept
+                {
+                    static_assert(TraitsType::Checkpoints);
+                    this->m_ChangedLevels |= decltype(this->m_ChangedLevels)(1) << Level;
+                }
+
+                // Get the value...
+                ValueType &GetValue() noexcept { return m_KeyValue.second; }
+                const ValueType &GetValue() const noexcept { return m_KeyValue.second; }
+
+                // Set the backward pointer on the bottom level, if we keep
+                //  one...
+                void SetBackPointer([[maybe_unused]] NodeType * const Node) noexcept
+                {
+                    if constexpr(HasBackPointer)
+                        this->m_BackPointer = Node;
+                }
+
+                // Set the given level's forward pointer...
+                void SetForwardPointer(
+                    const int Level,
+                    NodeType * const Node) noexcept
+                {
+                    assert(Level < m_Height);
+                    GetForwardPointers()[Level] = Node;
+                }
+
+                // Set the value, assigning directly from whatever is given...
+                template <typename OtherValueType>
+                void SetValue(OtherValueType &&NewValue) { m_KeyValue.second = std::forward<OtherValueType>(NewValue); }
+
+                // Get the given level's width, or the number of bottom level
+                //  steps its forward pointer skips. A null forward pointer
+                //  skips to one past the last node...
+                size_type GetWidth(const int Level) const noexcept
+                {
+                    static_assert(TraitsType::Indexable);
+                    assert(Level < m_Height);
+                    return GetWidths()[Level];
+                }
+
+                // Set the given level's width...
+                void SetWidth(const int Level, const size_type Width) noexcept
+                {
+                    static_assert(TraitsType::Indexable);
+                    assert(Level < m_Height);
+                    GetWidths()[Level] = Width;
+                }
+
+            // Public types...
+            public:
+
+                // Forward pointers type large enough to track one node for
+                //  every possible level, such as during a search...
+                using ForwardPointersType = std::array<NodeType *, MaximumLevels>;
+
+            // Protected methods...
+            protected:
+
+                // Get the start of the tower which begins immediately after
+                //  the node object itself...
+                NodeType **GetForwardPointers() const noexcept
+                {
+                    return reinterpret_cast<NodeType **>(
+                        const_cast<std::byte *>(reinterpret_cast<const std::byte *>(this)) + sizeof(NodeType));
+                }
+
+                // Get the start of the widths, which follow the tower...
+                size_type *GetWidths() const noexcept
+                {
+                    return reinterpret_cast<size_type *>(GetForwardPointers() + m_Height);
+                }
+
+            // Protected attributes...
+            protected:
+
+                // Key and value pair, which the header leaves unconstructed...
+                union { KeyValueType    m_KeyValue; };
+
+                // Number of forward pointers in the tower following us...
+                int                     m_Height;
+        };
+
+    // Public types...
+    public:
+
+        // View over the key value pairs from a lower bound up to but
+        //  excluding an upper bound key, as returned by Range(). The first
+        //  pair is found when the view is created, and iterating streams
+        //  along the bottom level, ending at the first key that reaches the
+        //  upper bound...
+        template <typename BoundKeyType>
+        class RangeType
+        {
+            // Public types...
+            public:
+
+                // Iterator over the view, which is also the end of the view
+                //  once it reaches the upper bound...
+                class RangeIteratorType : public SkipListIterator<NodeType>
+                {
+                    // Public traits...
+                    public:
+
+                        // The view can only be walked forwards...
+                        using iterator_category = std::forward_iterator_tag;
+
+                    // Public methods...
+                    public:
+
+                        // Default constructor...
+                        RangeIteratorType() noexcept
+                          : SkipListIterator<NodeType>(),
+                            m_Range(nullptr)
+                        {
+                        }
+
+                        // Construct pointing to the given node in the view's
+                        //  list, or the end if it's outside the view...
+                        RangeIteratorType(NodeType * const CurrentNode, const RangeType * const Range)
+                          : SkipListIterator<NodeType>(Range->Clip(CurrentNode)),
+                            m_Range(Range)
+                        {
+                        }
+
+                        // Prefix increment operator...
+                        RangeIteratorType &operator++()
+                        {
+                            // Seek to the next node on bottom level, unless it
+                            //  has reached the upper bound...
+                            this->m_CurrentNode = m_Range->Clip(
+                                this->m_CurrentNode->GetForwardPointer(0));
+
+                            // Return reference to updated iterator...
+                            return *this;
+                        }
+
+                        // Postfix increment operator...
+                        RangeIteratorType operator++(int)
+                        {
+                            // Return previous state, incrementing our self...
+                            return std::exchange(*this, ++RangeIteratorType(*this));
+                        }
+
+                    // Protected attributes...
+                    protected:
+
+                        // View we are iterating over...
+                        const RangeType    *m_Range;
+                };
+
+                // Type alias for iterator...
+                using iterator          = RangeIteratorType;
+
+                // Type alias for const iterator...
+                using const_iterator    = RangeIteratorType;
+
+            // Public methods...
+            public:
+
+                // Construct over the given list from the given first node up
+                //  to the given upper bound key...
+                RangeType(
+                    const SkipList &List,
+                    NodeType * const FirstNode,
+                    BoundKeyType UpperKey)
+                  : m_List(List),
+                    m_FirstNode(FirstNode),
+                    m_UpperKey(std::move(UpperKey))
+                {
+                }
+
+                // Retrieve an iterator to the first pair in the view...
+                iterator begin() const { return iterator(m_FirstNode, this); }
+
+                // Retrieve an iterator to the end of the view...
+                iterator end() const noexcept { return iterator(nullptr, this); }
+
+                // Check whether the view has no pairs...
+                bool IsEmpty() const { return begin() == end(); }
+
+            // Protected methods...
+            protected:
+
+                // Return the given node if it's within the view, or null if
+                //  we've reached the upper bound...
+                NodeType *Clip(NodeType * const Node) const
+                {
+                    return (Node && m_List.IsLessThan(Node->GetKey(), m_UpperKey))
+                        ? Node : nullptr;
+                }
+
+            // Protected attributes...
+            protected:
+
+                // List we are a view of...
+                const SkipList         &m_List;
+
+                // First node in the view, if any...
+                NodeType               *m_FirstNode;
+
+                // Upper bound, not included in the view...
+                BoundKeyType            m_UpperKey;
+        };
+
+    // Protected constants...
+    protected:
+
+        // Whether the comparison object can compare keys of other types with
+        //  ours directly...
+        template <typename ComparisonType, typename = void>
+        struct IsTransparentType : std::false_type {};
+        template <typename ComparisonType>
+        struct IsTransparentType<ComparisonType, std::void_t<typename ComparisonType::is_transparent>>
+          : std::true_type {};
+        static constexpr bool IsTransparent = IsTransparentType<LessThanComparisonType>::value;
+
+        // Signature beginning every serialised stream, ending with the
+        //  version of its format...
+        static constexpr unsigned char StreamSignature[5] = {'S', 'K', 'L', 'S', 1};
+
+        // Bits of the byte beginning each range in a serialised stream,
+        //  marking whether it has a lower and an upper bound...
+        static constexpr unsigned char StreamHasLowerKey = 1;
+        static constexpr unsigned char StreamHasUpperKey = 2;
+
+        // Fewest key value pairs ParallelBulkLoad() will give each thread,
+        //  below which the thread costs more than it saves...
+        static constexpr std::size_t ParallelGrainSize = 16 * 1024;
+
+        // Whether the allocator reports the bytes it holds...
+        template <typename OtherAllocatorType, typename = void>
+        struct HasReservedBytesType : std::false_type {};
+        template <typename OtherAllocatorType>
+        struct HasReservedBytesType<OtherAllocatorType, std::void_t<
+            decltype(std::declval<const OtherAllocatorType &>().GetReservedBytes())>>
+          : std::true_type {};
+        static constexpr bool HasReservedBytes = HasReservedBytesType<AllocatorType>::value;
+
+        // Whether the level generator can draw words to seed others with...
+        template <typename OtherLevelGeneratorType, typename = void>
+        struct HasSeededLevelGeneratorType : std::false_type {};
+        template <typename OtherLevelGeneratorType>
+        struct HasSeededLevelGeneratorType<OtherLevelGeneratorType, std::void_t<
+            decltype(OtherLevelGeneratorType(std::declval<OtherLevelGeneratorType &>().GetNextWord()))>>
+          : std::true_type {};
+        static constexpr bool HasSeededLevelGenerator =
+            HasSeededLevelGeneratorType<LevelGeneratorType>::value;
+
+        // Type to perform a lookup with for a key of the given type. If the
+        //  comparison object is transparent that's the given type, otherwise
+        //  it must be converted to our key type...
+        template <typename OtherKeyType>
+        using LookupKeyType = std::conditional_t<IsTransparent, OtherKeyType, KeyType>;
+
+        // Type to perform a lookup with for the keys the given iterator
+        //  visits...
+        template <typename KeyIteratorType>
+        using BatchKeyType = LookupKeyType<typename std::iterator_traits<KeyIteratorType>::value_type>;
+
+        // Number of searches to interleave in an unsorted batch search...
+        static constexpr int SearchBatchWidth = 16;
+
+        // Whether matching keys are found with == rather than the comparison
+        //  object. Integral keys under the default comparison always can...
+        static constexpr bool UseEqualityOperator =
+            TraitsType::EqualityOperator ||
+            (std::is_integral_v<KeyType> &&
+             (std::is_same_v<LessThanComparisonType, std::less<KeyType>> ||
+              std::is_same_v<LessThanComparisonType, std::less<>>));
+
+    // Protected methods...
+    protected:
+
+        // Join every node of the given list, all of whose keys must come after
+        //  ours, on to the end of this one in time proportional to the number
+        //  of levels, by linking each of our rightmost nodes to its header's
+        //  successor on the same level. The given list is left empty. If
+        //  absorbing its allocator throws, neither list has changed...
+        void Append(SkipList &Other)
+        {
+            // Nothing to do...
+            if(Other.m_Size == 0)
+                return;
+
+            // Take over responsibility for the other's nodes first...
+            m_Allocator.Absorb(Other.m_Allocator);
+
+            // Any finger a hinted insertion left no longer is valid...
+            m_HintFingerValid = false;
+
+            // Check invariants...
+            assert((m_Size == 0) ||
+                   IsLessThan(m_RightmostNodes[0]->GetKey(), Other.m_Header->GetForwardPointer(0)->GetKey()));
+
+            // Our old tail, which the other's first node now follows...
+            NodeType * const LastNode = m_RightmostNodes[0];
+
+            // On each of our levels, the rightmost node's span now also covers
+            //  the other's nodes...
+            const int HighestLevel = std::max(m_HighestLevel, Other.m_HighestLevel);
+            for(int CurrentLevel = 0; CurrentLevel <= HighestLevel; ++CurrentLevel)
+            {
+                NodeType * const LeftNode = m_RightmostNodes[CurrentLevel];
+
+                // Link it to the other's first node on this level, if it has
+                //  one, which is the number of steps the other's header skips
+                //  past the end of ours. A level new to us begins at our
+                //  header, which skips all of our nodes as well...
+                if(CurrentLevel <= Other.m_HighestLevel)
+                {
+                    LeftNode->SetForwardPointer(
+                        CurrentLevel, Other.m_Header->GetForwardPointer(CurrentLevel));
+                    if constexpr(TraitsType::Indexable)
+                    {
+                        LeftNode->SetWidth(CurrentLevel,
+                            ((CurrentLevel <= m_HighestLevel) ? LeftNode->GetWidth(CurrentLevel) - 1 : m_Size) +
+                            Other.m_Header->GetWidth(CurrentLevel));
+                    }
+                    m_RightmostNodes[CurrentLevel] = Other.m_RightmostNodes[CurrentLevel];
+                }
+
+                // Otherwise it just skips all of them too...
+                else if constexpr(TraitsType::Indexable)
+                    LeftNode->SetWidth(CurrentLevel, LeftNode->GetWidth(CurrentLevel) + Other.m_Size);
+
+                // Its span on every level but the bottom now holds the other's
+                //  nodes, which were themselves all new to it...
+                if constexpr(TraitsType::Checkpoints)
+                {
+                    if(CurrentLevel)
+                        LeftNode->MarkChanged(CurrentLevel);
+                }
+            }
+            UpdateBackPointer(LastNode);
+            UpdateBackPointer(m_RightmostNodes[0]);
+
+            // Take over the other's nodes...
+            m_HighestLevel = HighestLevel;
+            m_Size += Other.m_Size;
+            m_TowerLevels += Other.m_TowerLevels;
+
+            // The other list no longer holds any nodes...
+            Other.ResetHeader();
+        }
+
+        // Append a range of key value pairs, sorted by key, as BulkLoad()
+        //  does. Balanced levels are chosen as though the given number of
+        //  positions preceded the list, so that a list built in pieces is
+        //  balanced as a whole...
+        template <typename InputIteratorType>
+        void AppendSorted(
+            InputIteratorType First,
+            const InputIteratorType Last,
+            const SkipListLevelAssignment LevelAssignment,
+            const size_type PositionBase)
+        {
+            // Any finger a hinted insertion left may no longer be valid...
+            m_HintFingerValid = false;
+
+            // Append each key value pair after the rightmost node on each level
+            //  it participates in...
+            for(; First != Last; ++First)
+            {
+                // Key value pair to append...
+                auto &&KeyValue = *First;
+
+                // Last node in the list, if any...
+                NodeType * const LastNode = m_RightmostNodes[0];
+
+                // The range must have been sorted...
+                assert(LastNode == m_Header || !IsLessThan(KeyValue.first, LastNode->GetKey()));
+
+                // If this is the same key as the last node, then just update
+                //  its value, unless duplicates are allowed...
+                if(!TraitsType::DuplicateKeys &&
+                   LastNode != m_Header && !IsLessThan(LastNode->GetKey(), KeyValue.first))
+                {
+                    // Update the value...
+                    LastNode->SetValue(std::forward<decltype(KeyValue)>(KeyValue).second);
+                    MarkChanged(LastNode, m_RightmostNodes);
+                    continue;
+                }
+
+                // Choose the new node's level...
+                const int NewLevel =
+                    (LevelAssignment == SkipListLevelAssignment::Balanced)
+                        ? GetBalancedLevel(PositionBase + m_Size + 1)
+                        : GetRandomLevel();
+
+                // Allocate the new node with its key and value...
+                NodeType * const NewNode = CreateNode(
+                    NewLevel + 1, std::forward<decltype(KeyValue)>(KeyValue));
+
+                // Appending leaves the width of each rightmost node it
+                //  follows unchanged, since it still skips to one past the
+                //  end, while the new node's skip only past itself. The
+                //  header skips everything on a new level, and the rest skip
+                //  one more...
+                if constexpr(TraitsType::Indexable)
+                {
+                    for(int CurrentLevel = 0; CurrentLevel <= NewLevel; ++CurrentLevel)
+                    {
+                        NewNode->SetWidth(CurrentLevel, 1);
+                        if(CurrentLevel > m_HighestLevel)
+                            m_Header->SetWidth(CurrentLevel, m_Size + 1);
+                    }
+                    for(int CurrentLevel = NewLevel + 1; CurrentLevel <= m_HighestLevel; ++CurrentLevel)
+                        m_RightmostNodes[CurrentLevel]->SetWidth(
+                            CurrentLevel, m_RightmostNodes[CurrentLevel]->GetWidth(CurrentLevel) + 1);
+                }
+
+                // Append it to the end of every level it participates in...
+                NewNode->SetBackPointer(LastNode);
+                for(int CurrentLevel = 0; CurrentLevel <= NewLevel; ++CurrentLevel)
+                {
+                    m_RightmostNodes[CurrentLevel]->SetForwardPointer(CurrentLevel, NewNode);
+                    m_RightmostNodes[CurrentLevel] = NewNode;
+                }
+                UpdateBackPointer(NewNode);
+
+                // Remember if we've increased the highest level in the list...
+                m_HighestLevel = std::max(m_HighestLevel, NewLevel);
+                MarkChanged(NewNode, m_RightmostNodes);
+
+                // Update node count...
+              ++m_Size;
+            }
+        }
+
+        // Construct a list out of every node of the given list whose key is
+        //  not less than the given key, as described for SplitAt()...
+        template <typename OtherKeyType>
+        SkipList(SplitTagType, SkipList &Source, const OtherKeyType &Key)
+          : SkipList(Source.m_LessThanComparison, Source.m_Allocator.Share(), Source.GetSiblingLevelGenerator())
+        {
+            // Find the last node to stay behind on every level, along with its
+            //  rank if we need it, counting the header as zero. Each level's
+            //  descends from where the level above's left off...
+            typename NodeType::ForwardPointersType UpdatedPointers;
+            Source.SeekPredecessor(Key, &UpdatedPointers);
+            std::array<size_type, MaximumLevels> Ranks{};
+            if constexpr(TraitsType::Indexable)
+            {
+                size_type Rank = 0;
+                NodeType *CurrentNode = Source.m_Header;
+                for(int CurrentLevel = Source.m_HighestLevel; CurrentLevel >= 0; --CurrentLevel)
+                {
+                    for(; CurrentNode != UpdatedPointers[CurrentLevel];
+                        CurrentNode = CurrentNode->GetForwardPointer(CurrentLevel))
+                        Rank += CurrentNode->GetWidth(CurrentLevel);
+                    Ranks[CurrentLevel] = Rank;
+                }
+            }
+
+            // Nothing to move...
+            NodeType * const FirstNode = UpdatedPointers[0]->GetForwardPointer(0);
+            if(!FirstNode)
+                return;
+
+            // Any finger a hinted insertion left on the source may refer to
+            //  nodes it's about to lose...
+            Source.m_HintFingerValid = false;
+
+            // Count the nodes moving and their levels, handing each over to
+            //  our allocator and, if we keep checkpoints, marking it as new to
+            //  us...
+            for(NodeType *CurrentNode = FirstNode; CurrentNode;
+                CurrentNode = CurrentNode->GetForwardPointer(0))
+            {
+                const int Height = CurrentNode->GetLevel();
+                Source.m_Allocator.Transfer(
+                    m_Allocator, NodeType::GetAllocationSize(Height), Height);
+              ++m_Size;
+                m_TowerLevels += static_cast<size_type>(Height);
+                if constexpr(TraitsType::Checkpoints)
+                {
+                    for(int CurrentLevel = 0; CurrentLevel < Height; ++CurrentLevel)
+                        CurrentNode->MarkChanged(CurrentLevel);
+                }
+            }
+            Source.m_Size -= m_Size;
+            Source.m_TowerLevels -= m_TowerLevels;
+
+            // Cut each level after the last node staying behind on it. Whatever
+            //  followed it is now first on that level of ours, as many steps
+            //  from our header as it was past the source's new end, while it
+            //  skips to one past that end. That's so even where nothing
+            //  followed it, since appending trusts the rightmost node's width...
+            const size_type FirstRank = Source.m_Size + 1;
+            for(int CurrentLevel = 0; CurrentLevel <= Source.m_HighestLevel; ++CurrentLevel)
+            {
+                NodeType * const LeftNode = UpdatedPointers[CurrentLevel];
+                NodeType * const NextNode = LeftNode->GetForwardPointer(CurrentLevel);
+                if(!NextNode)
+                {
+                    if constexpr(TraitsType::Indexable)
+                        LeftNode->SetWidth(CurrentLevel, FirstRank - Ranks[CurrentLevel]);
+                    continue;
+                }
+                m_Header->SetForwardPointer(CurrentLevel, NextNode);
+                if constexpr(TraitsType::Indexable)
+                {
+                    m_Header->SetWidth(CurrentLevel,
+                        Ranks[CurrentLevel] + LeftNode->GetWidth(CurrentLevel) - Source.m_Size);
+                    LeftNode->SetWidth(CurrentLevel, FirstRank - Ranks[CurrentLevel]);
+                }
+                LeftNode->SetForwardPointer(CurrentLevel, nullptr);
+                m_RightmostNodes[CurrentLevel] = Source.m_RightmostNodes[CurrentLevel];
+                Source.m_RightmostNodes[CurrentLevel] = LeftNode;
+                m_HighestLevel = CurrentLevel;
+            }
+
+            // The source is only as tall as the highest level it still has a
+            //  node on...
+            Source.TrimHighestLevel();
+
+            // Point each tail back at the node before it, and our first node
+            //  back at our header...
+            FirstNode->SetBackPointer(m_Header);
+            UpdateBackPointer(m_RightmostNodes[0]);
+            Source.UpdateBackPointer(UpdatedPointers[0]);
+
+            // The source lost everything after the last node it kept...
+            Source.MarkChanged(UpdatedPointers[0], UpdatedPointers);
+        }
+
+        // Allocate and construct a node of the given height, forwarding the
+        //  remaining arguments to its constructor...
+        template <typename... ArgumentTypes>
+        NodeType *CreateNode(const int Height, ArgumentTypes &&... Arguments)
+        {
+            // Allocate storage for the node and its tower together...
+            void * const Storage = m_Allocator.Allocate(
+                NodeType::GetAllocationSize(Height), alignof(NodeType), Height);
+
+            // Construct the node in place, releasing the storage if the key or
+            //  value threw during construction...
+            NodeType *NewNode = nullptr;
+            try
+            {
+                NewNode = new(Storage) NodeType(
+                    Height, std::forward<ArgumentTypes>(Arguments)...);
+            }
+            catch(...)
+            {
+                m_Allocator.Deallocate(
+                    Storage, NodeType::GetAllocationSize(Height), Height);
+                throw;
+            }
+
+            // Count its tower's levels and return it...
+            m_TowerLevels += static_cast<size_type>(Height);
+            return NewNode;
+        }
+
+        // Allocate and construct a header node of the given height, without a
+        //  key or value. It comes from the free store rather than the node
+        //  allocator so it survives the allocator releasing all nodes...
+        static NodeType *CreateSentinelNode(const int Height)
+        {
+            // Allocate storage for the node and its tower together, and
+            //  construct it in place, which can't throw...
+            void * const Storage = ::operator new(NodeType::GetAllocationSize(Height));
+            return new(Storage) NodeType(SentinelTagType(), Height);
+        }
+
+        // Destroy and de-allocate the given node...
+        void DestroyNode(NodeType * const Node) noexcept
+        {
+            // Remember the node's height before it is destroyed...
+            const int Height = Node->GetLevel();
+
+            // Any finger a hinted insertion left may no longer be valid...
+            m_HintFingerValid = false;
+
+            // Destroy the node's key and value...
+            Node->~NodeType();
+
+            // Release its storage, and stop counting its tower's levels...
+            m_Allocator.Deallocate(
+                Node, NodeType::GetAllocationSize(Height), Height);
+            m_TowerLevels -= static_cast<size_type>(Height);
+        }
+
+        // Destroy every node after the header, leaving the header's forward
+        //  pointers dangling for the caller to repair...
+        void DestroyNodes() noexcept
+        {
+            // If there is nothing to destroy in each node and the allocator
+            //  can release all of its nodes at once, let it do so without
+            //  walking the list...
+            if constexpr(std::is_trivially_destructible_v<KeyValueType> &&
+                         AllocatorType::CanDeallocateAll)
+                m_Allocator.DeallocateAll();
+
+            // Otherwise walk the bottom level destroying each node...
+            else
+            {
+                // Track the current node we are about to delete, beginning
+                //  with the first after the header...
+                NodeType *CurrentNode = m_Header->GetForwardPointer(0);
+
+                // Keep walking the list, deleting nodes, until we reach the
+                //  end...
+                while(CurrentNode)
+                {
+                    // Get the pointer to the next node, if any...
+                    NodeType * const NextNode = CurrentNode->GetForwardPointer(0);
+
+                    // Delete the current node...
+                    DestroyNode(CurrentNode);
+
+                    // Seek to the next one, if any...
+                    CurrentNode = NextNode;
+                }
+            }
+        }
+
+        // Destroy and de-allocate the given header node...
+        static void DestroySentinelNode(NodeType * const Node) noexcept
+        {
+            // It has no key or value to destroy, and nothing else in it needs
+            //  destroying, so just release its storage...
+            ::operator delete(Node);
+        }
+
+        // Reset the header to that of an empty list, once its nodes have been
+        //  released or handed to another list...
+        void ResetHeader() noexcept
+        {
+            // Any finger a hinted insertion left no longer is valid...
+            m_HintFingerValid = false;
+
+            // Update the header's forward pointers to mark the end of the
+            //  list. Those above the highest level already do...
+            for(int CurrentLevel = 0; CurrentLevel <= m_HighestLevel; ++CurrentLevel)
+                m_Header->SetForwardPointer(CurrentLevel, nullptr);
+
+            // The header is once again the rightmost node on every level...
+            m_RightmostNodes.fill(m_Header);
+            UpdateBackPointer(m_Header);
+
+            // The header's bottom level once again skips to one past the
+            //  end...
+            if constexpr(TraitsType::Indexable)
+                m_Header->SetWidth(0, 1);
+
+            // The gap after the header, which is now everything, changed...
+            if constexpr(TraitsType::Checkpoints)
+                m_Header->MarkChanged(0);
+
+            // Reset the highest level to only one... (we start counting at zero)
+            m_HighestLevel = 0;
+
+            // Reset the element count, and the levels of their towers...
+            m_Size = 0;
+            m_TowerLevels = 0;
+        }
+
+
+        // Remove the run of nodes at the front of the list the given predicate
+        //  accepts, as ExtractWhile() describes, calling the given consumer
+        //  with each key value pair before releasing its node. Return the
+        //  number removed...
+        template <typename PredicateType, typename ConsumerType>
+        size_type ExtractFront(PredicateType &Predicate, ConsumerType &&Consume)
+        {
+            // Count this deletion...
+            OperationScopeType Scope(m_Statistics, SkipListOperation::Delete);
+
+            // What the header skips to on each level, and in indexable lists
+            //  that node's rank...
+            typename NodeType::ForwardPointersType NextNodes{};
+            std::array<size_type, MaximumLevels> Ranks{};
+            for(int CurrentLevel = 0; CurrentLevel <= m_HighestLevel; ++CurrentLevel)
+            {
+                NextNodes[CurrentLevel] = m_Header->GetForwardPointer(CurrentLevel);
+                if constexpr(TraitsType::Indexable)
+                    Ranks[CurrentLevel] = m_Header->GetWidth(CurrentLevel);
+            }
+
+            // Find the end of the run before changing anything, so that a
+            //  throwing predicate leaves the list as it was. Once those
+            //  before it are gone, each node in the run is the first on each
+            //  of its levels, so the header takes over its forward pointers
+            //  there...
+            NodeType * const FirstNode = NextNodes[0];
+            size_type Extracted = 0;
+            for(NodeType *CurrentNode = FirstNode;
+                CurrentNode && Predicate(std::as_const(CurrentNode->GetKeyValue()));
+                CurrentNode = CurrentNode->GetForwardPointer(0))
+            {
+                for(int CurrentLevel = 0; CurrentLevel < CurrentNode->GetLevel(); ++CurrentLevel)
+                {
+                    NextNodes[CurrentLevel] = CurrentNode->GetForwardPointer(CurrentLevel);
+                    if constexpr(TraitsType::Indexable)
+                        Ranks[CurrentLevel] += CurrentNode->GetWidth(CurrentLevel);
+                }
+              ++Extracted;
+            }
+
+            // Nothing to remove...
+            if(Extracted == 0)
+                return 0;
+
+            // Splice the run out of the header on every level. It becomes the
+            //  rightmost node on any level the run emptied. Every node after
+            //  the run moves as many positions closer...
+            for(int CurrentLevel = 0; CurrentLevel <= m_HighestLevel; ++CurrentLevel)
+            {
+                m_Header->SetForwardPointer(CurrentLevel, NextNodes[CurrentLevel]);
+                if(!NextNodes[CurrentLevel])
+                    m_RightmostNodes[CurrentLevel] = m_Header;
+                if constexpr(TraitsType::Indexable)
+                    m_Header->SetWidth(CurrentLevel, Ranks[CurrentLevel] - Extracted);
+            }
+
+            // The node after the run, or the header if there isn't one, now
+            //  points back to the header...
+            UpdateBackPointer(m_Header);
+
+            // The gap after the header now holds the change...
+            typename NodeType::ForwardPointersType UpdatedPointers;
+            UpdatedPointers.fill(m_Header);
+            MarkChanged(m_Header, UpdatedPointers);
+
+            // Forget the run's nodes, and the levels only they reached...
+            m_Size -= Extracted;
+            TrimHighestLevel();
+
+            // Hand each pair in the run to the consumer, and release its node.
+            //  If the consumer throws, release the rest anyway...
+            NodeType *CurrentNode = FirstNode;
+            size_type Remaining = Extracted;
+            try
+            {
+                for(; Remaining; --Remaining)
+                {
+                    Consume(std::move(CurrentNode->GetKeyValue()));
+                    DestroyNode(std::exchange(CurrentNode, CurrentNode->GetForwardPointer(0)));
+                }
+            }
+            catch(...)
+            {
+                for(; Remaining; --Remaining)
+                    DestroyNode(std::exchange(CurrentNode, CurrentNode->GetForwardPointer(0)));
+                throw;
+            }
+
+            // Return the number of elements removed...
+            return Extracted;
+        }
+
+        // Count the keys less than the given key by descending as in a search,
+        //  summing the widths of every forward pointer followed. If inclusive,
+        //  count those not greater instead. Only for indexable lists...
+        template <bool Inclusive = false, typename OtherKeyType>
+        size_type CountBefore(const OtherKeyType &Key) const noexcept
+        {
+            size_type Rank = 0;
+            NodeType *CurrentNode = m_Header;
+            for(int CurrentLevel = m_HighestLevel; CurrentLevel >= 0; --CurrentLevel)
+            {
+                for(NodeType *NextNode = CurrentNode->GetForwardPointer(CurrentLevel);
+                    NextNode && IsBefore<Inclusive>(NextNode->GetKey(), Key);
+                    NextNode = CurrentNode->GetForwardPointer(CurrentLevel))
+                {
+                    Rank += CurrentNode->GetWidth(CurrentLevel);
+                    CurrentNode = NextNode;
+                }
+            }
+
+            // The rank of the node on the left is the number of keys before...
+            return Rank;
+        }
+
+        // Delete the node with the key equivalent to the given one, if any,
+        //  or every such node if the list allows duplicate keys. Return
+        //  number of deleted elements...
+        template <typename OtherKeyType>
+        size_type DeleteKey(const OtherKeyType &Key) noexcept
+        {
+            // Count this deletion...
+            OperationScopeType Scope(m_Statistics, SkipListOperation::Delete);
+
+            // Vector of forward pointers to maintain that is populated after
+            //  the search is completed, but before performing the actual
+            //  splice. Each level contains the rightmost node of that level or
+            //  higher that is to the left of the location of the pending
+            //  deletion...
+            typename NodeType::ForwardPointersType
+                UpdatedPointers{};
+
+            // Find the node on the left of the location of the node to
+            //  delete on each level...
+            NodeType *CurrentNode = SeekPredecessor(Key, &UpdatedPointers);
+
+            // The next node is either the node to be deleted if it exists, or
+            //  not...
+            CurrentNode = CurrentNode->GetForwardPointer(0);
+
+            // We ran off the end of the list or this node does not have the key
+            //  we are looking for, so signal to caller it did not exist...
+            if(!CurrentNode || !IsMatch(CurrentNode->GetKey(), Key))
+                return 0;
+
+            // Otherwise we've found the node with the key we need to delete...
+            else
+            {
+                // Unlink and release it...
+                UnlinkNode(UpdatedPointers, CurrentNode);
+
+                // Without duplicates, signal to user deletion of a single
+                //  element...
+                if constexpr(!TraitsType::DuplicateKeys)
+                    return 1;
+
+                // Otherwise each duplicate now follows the same nodes, so
+                //  unlink those too...
+                else
+                {
+                    size_type Deleted = 1;
+                    while((CurrentNode = UpdatedPointers[0]->GetForwardPointer(0)) &&
+                          IsMatch(CurrentNode->GetKey(), Key))
+                    {
+                        UnlinkNode(UpdatedPointers, CurrentNode);
+                      ++Deleted;
+                    }
+                    return Deleted;
+                }
+            }
+        }
+
+        // Unlink the given node from after the given nodes on every level it
+        //  participates in, which must be populated up to the list's highest,
+        //  and release it...
+        void UnlinkNode(
+            const typename NodeType::ForwardPointersType &UpdatedPointers,
+            NodeType * const Node) noexcept
+        {
+            // Splice pointers to point through the node we're about to
+            //  delete to the next over, on every level it is linked
+            //  into...
+            for(int CurrentLevel = 0; CurrentLevel < Node->GetLevel(); ++CurrentLevel)
+            {
+                // The node on the left on this level must point to the one
+                //  to be deleted...
+                NodeType * const LeftNode = UpdatedPointers[CurrentLevel];
+                assert(LeftNode->GetForwardPointer(CurrentLevel) == Node);
+
+                // Repair link between node on the left to the one to the
+                //  next one to the right of the node to be deleted...
+                LeftNode->SetForwardPointer(
+                    CurrentLevel,
+                    Node->GetForwardPointer(CurrentLevel));
+
+                // If it was the rightmost on this level, then the node on
+                //  its left now is...
+                if(m_RightmostNodes[CurrentLevel] == Node)
+                    m_RightmostNodes[CurrentLevel] = LeftNode;
+            }
+
+            // Merge the widths the node divided, and narrow those it
+            //  passed beneath...
+            if constexpr(TraitsType::Indexable)
+            {
+                for(int CurrentLevel = 0; CurrentLevel <= m_HighestLevel; ++CurrentLevel)
+                {
+                    NodeType * const LeftNode = UpdatedPointers[CurrentLevel];
+                    if(CurrentLevel < Node->GetLevel())
+                        LeftNode->SetWidth(CurrentLevel,
+                            LeftNode->GetWidth(CurrentLevel) + Node->GetWidth(CurrentLevel) - 1);
+                    else
+                        LeftNode->SetWidth(CurrentLevel, LeftNode->GetWidth(CurrentLevel) - 1);
+                }
+            }
+
+            // The node after it, or the header if it was the tail, now
+            //  points back to the node on its left...
+            UpdateBackPointer(UpdatedPointers[0]);
+
+            // The gap after the node on its left now holds the change...
+            MarkChanged(UpdatedPointers[0], UpdatedPointers);
+
+            // De-allocate the node...
+            DestroyNode(Node);
+
+            // If we deleted the node with the highest level, adjust the
+            //  list's highest level down to match the next highest...
+            TrimHighestLevel();
+
+            // Update the number of elements...
+          --m_Size;
+        }
+
+        // Call the given visitor with the given key value pair, returning
+        //  whether visiting should continue. That's whatever the visitor
+        //  returned if it returns a boolean, or always otherwise...
+        template <typename VisitorType>
+        static bool Visit(VisitorType &Visitor, const KeyValueType &KeyValue)
+        {
+            if constexpr(std::is_convertible_v<
+                std::invoke_result_t<VisitorType &, const KeyValueType &>, bool>)
+                return static_cast<bool>(Visitor(KeyValue));
+            else
+            {
+                Visitor(KeyValue);
+                return true;
+            }
+        }
+
+        // Visit every node from the first up to but excluding the last, until
+        //  the visitor asks to stop. Return the number visited...
+        template <typename VisitorType>
+        static size_type VisitNodes(
+            const NodeType *CurrentNode,
+            const NodeType * const LastNode,
+            VisitorType &Visitor)
+        {
+            size_type Visited = 0;
+            for(; CurrentNode != LastNode; CurrentNode = CurrentNode->GetForwardPointer(0))
+            {
+              ++Visited;
+                if(!Visit(Visitor, CurrentNode->GetKeyValue()))
+                    break;
+            }
+            return Visited;
+        }
+
+        // Find the node with the key equivalent to the given one, returning
+        //  null if there isn't one...
+        template <typename OtherKeyType>
+        NodeType *FindNode(const OtherKeyType &SearchKey) const noexcept
+        {
+            // Count this search...
+            OperationScopeType Scope(m_Statistics, SkipListOperation::Search);
+
+            // Find the rightmost node less than the search key...
+            NodeType *CurrentNode = SeekPredecessor(SearchKey);
+
+            // The next node is the search key, if it's present at all...
+            CurrentNode = CurrentNode->GetForwardPointer(0);
+
+            // Return it if we found the search key...
+            if(CurrentNode && IsMatch(CurrentNode->GetKey(), SearchKey))
+                return CurrentNode;
+
+            // Otherwise signal not found...
+            else
+                return nullptr;
+        }
+
+        // Select the level the node at the given one-based position would have
+        //  in a perfectly balanced skip list, which is the number of times the
+        //  level generator's promotion denominator divides the position. One
+        //  in every that many nodes on each level then reaches the next, just
+        //  as the generator promotes them on average...
+        static int GetBalancedLevel(size_type Position) noexcept
+        {
+            // Count the trailing zero digits in that base, never exceeding the
+            //  maximum permissible level...
+            constexpr size_type Denominator =
+                SkipListPromotionDenominator<LevelGeneratorType>::value;
+            int CurrentLevel = 0;
+            while(((Position % Denominator) == 0) && (CurrentLevel < (MaximumLevels - 1)))
+            {
+                Position /= Denominator;
+              ++CurrentLevel;
+            }
+
+            // Return the node's level...
+            return CurrentLevel;
+        }
+
+        // Get an allocator for another list whose nodes we may later absorb.
+        //  A copy of ours if it can be copied, otherwise a new one...
+        AllocatorType GetSiblingAllocator() const
+        {
+            if constexpr(std::is_copy_constructible_v<AllocatorType>)
+                return AllocatorType(m_Allocator);
+            else
+                return AllocatorType();
+        }
+
+        // Get a level generator for another list we build, seeded from ours
+        //  if it can be, so that a seed still fixes every list we build...
+        LevelGeneratorType GetSiblingLevelGenerator()
+        {
+            if constexpr(HasSeededLevelGenerator)
+                return LevelGeneratorType(m_LevelGenerator.GetNextWord());
+            else
+                return LevelGeneratorType();
+        }
+
+        // Lower the highest level past any the header no longer has a node
+        //  after, so that searches never descend through empty levels. The
+        //  header's forward pointers above the highest level are then always
+        //  null...
+        void TrimHighestLevel() noexcept
+        {
+            while((m_HighestLevel > 0) && !m_Header->GetForwardPointer(m_HighestLevel))
+              --m_HighestLevel;
+        }
+
+        // Select a random level. Useful when creating a new node...
+        int GetRandomLevel() noexcept
+        {
+            return m_LevelGenerator.GetLevel(MaximumLevels);
+        }
+
+        // Make an iterator pointing to the given node, or the end if null.
+        //  Iterators over lists with back pointers also need our header so
+        //  that the end can be decremented...
+        iterator MakeIterator(NodeType * const Node) const noexcept
+        {
+            return iterator(Node, m_Header);
+        }
+
+        // Find the rightmost node less than the given key on every level up
+        //  to the highest, starting from a finger holding the rightmost nodes
+        //  less than some earlier key, or the header, on every level, and
+        //  leaving it holding those for this key. With their ranks, counting
+        //  the header as zero, too, if provided. Rather than descending from
+        //  the top of the header, the search need only climb as high as the
+        //  distance between the keys requires. If inclusive, find the
+        //  rightmost nodes not greater than the key instead...
+        template <bool Inclusive = false, typename OtherKeyType>
+        NodeType *SeekFromFinger(
+            const OtherKeyType &Key,
+            typename NodeType::ForwardPointersType &Predecessors,
+            [[maybe_unused]] std::array<size_type, MaximumLevels> * const Ranks = nullptr) const
+        {
+            // Since every predecessor is less than the earlier key, it is also
+            //  less than this one. Climb from the bottom only as far as we
+            //  still need to move right...
+            int StartLevel = 0;
+            while(StartLevel < m_HighestLevel)
+            {
+                // Next node on this level from our finger...
+                const NodeType * const NextNode =
+                    Predecessors[StartLevel]->GetForwardPointer(StartLevel);
+
+                // If it doesn't overshoot, then a higher level might reach it
+                //  sooner...
+                if(NextNode && IsBefore<Inclusive>(NextNode->GetKey(), Key))
+                  ++StartLevel;
+
+                // Otherwise this level needs no movement...
+                else
+                    break;
+            }
+
+            // Descend from there. Until we've moved right on some level, each
+            //  level's previous predecessor is the furthest right we can
+            //  safely start from. After we have moved, we are already right
+            //  of every previous predecessor...
+            NodeType *CurrentNode = Predecessors[StartLevel];
+            size_type Rank = 0;
+            bool Moved = false;
+            for(int CurrentLevel = StartLevel; CurrentLevel >= 0; --CurrentLevel)
+            {
+                // Resume from the previous predecessor if we haven't moved
+                //  yet...
+                if(!Moved)
+                {
+                    CurrentNode = Predecessors[CurrentLevel];
+                    if constexpr(TraitsType::Indexable)
                     {
-                        // If it's non-null then we know we have a link to
-                        //  another node...
-                        if(Node)
-                          ++Level;
-
-                        // Otherwise we have reached the highest level of this
-                        //  node...
-                        else
-                            break;
+                        if(Ranks)
+                            Rank = (*Ranks)[CurrentLevel];
                     }
+                }
 
-                    // Return node level...
-                    return Level;
+                // Keep moving right on this level as far as we can without
+                //  overshooting...
+                NodeType *NextNode = CurrentNode->GetForwardPointer(CurrentLevel);
+                while(NextNode && IsBefore<Inclusive>(NextNode->GetKey(), Key))
+                {
+                    if constexpr(TraitsType::Indexable)
+                    {
+                        if(Ranks)
+                            Rank += CurrentNode->GetWidth(CurrentLevel);
+                    }
+                    CurrentNode = NextNode;
+                    NextNode    = CurrentNode->GetForwardPointer(CurrentLevel);
+                    Moved       = true;
+                    m_Statistics.CountHop(CurrentLevel);
                 }
+                m_Statistics.CountLevel();
 
-                // Get the value...
-                ValueType &GetValue() noexcept { return m_KeyValue.second; }
-                const ValueType &GetValue() const noexcept { return m_KeyValue.second; }
+                // Remember this level's predecessor for the next key...
+                Predecessors[CurrentLevel] = CurrentNode;
+                if constexpr(TraitsType::Indexable)
+                {
+                    if(Ranks)
+                        (*Ranks)[CurrentLevel] = Rank;
+                }
+            }
 
-                // Set the given level's forward pointer...
-                void SetForwardPointer(
-                    const int Level,
-                    NodeType * const Node) noexcept
+            // Return the rightmost node before the key...
+            return CurrentNode;
+        }
+
+        // Search for each of the given keys while they're sorted. Each key's
+        //  predecessors on every level are kept as a finger for the next
+        //  key. The rest are searched for interleaved from the first key the
+        //  finger has already passed...
+        template <typename KeyIteratorType, typename OutputIteratorType>
+        OutputIteratorType SearchSortedBatch(
+            KeyIteratorType KeysBegin,
+            const KeyIteratorType KeysEnd,
+            OutputIteratorType Output) const
+        {
+            // The rightmost node on each level less than the previous key. To
+            //  begin with, this is the header on every level...
+            typename NodeType::ForwardPointersType Predecessors;
+            Predecessors.fill(m_Header);
+
+            // Search for each key...
+            for(; KeysBegin != KeysEnd; ++KeysBegin)
+            {
+                // Key to search for...
+                const BatchKeyType<KeyIteratorType> &SearchKey = *KeysBegin;
+
+                // The finger can only be resumed from if every predecessor is
+                //  less than the key. The bottom level's is the rightmost...
+                if((Predecessors[0] != m_Header) && !IsLessThan(Predecessors[0]->GetKey(), SearchKey))
+                    return SearchInterleavedBatch(KeysBegin, KeysEnd, Output);
+
+                // The next node after its predecessor is the search key, if
+                //  it's present at all...
+                NodeType * const FoundNode =
+                    SeekFromFinger(SearchKey, Predecessors)->GetForwardPointer(0);
+                *Output++ = (FoundNode && IsMatch(FoundNode->GetKey(), SearchKey))
+                    ? MakeIterator(FoundNode) : end();
+            }
+
+            // Return output past the last result written...
+            return Output;
+        }
+
+        // Search for each of the given keys, in any order. Searches are
+        //  performed in groups that advance one step each in turn, with each
+        //  search prefetching the node it will examine on its next step, so
+        //  that the cache misses of the group overlap rather than
+        //  serialise...
+        template <typename KeyIteratorType, typename OutputIteratorType>
+        OutputIteratorType SearchInterleavedBatch(
+            KeyIteratorType KeysBegin,
+            const KeyIteratorType KeysEnd,
+            OutputIteratorType Output) const
+        {
+            // State of a single search in flight...
+            struct SearchStateType
+            {
+                // Position of the key to search for...
+                KeyIteratorType m_Key;
+
+                // Rightmost node found so far less than the key...
+                NodeType       *m_CurrentNode;
+
+                // Level being examined, or negative once finished...
+                int             m_Level;
+            };
+
+            // Searches in flight...
+            std::array<SearchStateType, SearchBatchWidth> Searches;
+
+            // Keep starting groups of searches while there are keys...
+            while(KeysBegin != KeysEnd)
+            {
+                // Start a search for each key in the group...
+                int GroupSize = 0;
+                for(; (GroupSize < SearchBatchWidth) && (KeysBegin != KeysEnd); ++GroupSize, ++KeysBegin)
                 {
-                    m_ForwardPointers.at(Level) = Node;
+                    Searches[GroupSize] = {KeysBegin, m_Header, m_HighestLevel};
+                    PrefetchNode(m_Header->GetForwardPointer(m_HighestLevel));
                 }
 
-                // Set every forward pointer in the node to point to the
-                //  given...
-                void SetForwardPointers(NodeType * const Node) noexcept
+                // Step through each unfinished search in turn until they are
+                //  all finished...
+                for(int Remaining = GroupSize; Remaining > 0;)
                 {
-                    m_ForwardPointers.fill(Node);
+                    for(int Index = 0; Index < GroupSize; ++Index)
+                    {
+                        // This search...
+                        SearchStateType &Search = Searches[Index];
+
+                        // Skip it if it's already finished...
+                        if(Search.m_Level < 0)
+                            continue;
+
+                        // Move right if doing so doesn't overshoot...
+                        NodeType * const NextNode =
+                            Search.m_CurrentNode->GetForwardPointer(Search.m_Level);
+                        const BatchKeyType<KeyIteratorType> &SearchKey = *Search.m_Key;
+                        if(NextNode && IsLessThan(NextNode->GetKey(), SearchKey))
+                            Search.m_CurrentNode = NextNode;
+
+                        // Otherwise descend, finishing if we were already at
+                        //  the bottom...
+                        else if(--Search.m_Level < 0)
+                        {
+                          --Remaining;
+                            continue;
+                        }
+
+                        // Fetch the node we will examine on our next turn...
+                        PrefetchNode(Search.m_CurrentNode->GetForwardPointer(Search.m_Level));
+                    }
                 }
 
-                // Set the value...
-                void SetValue(ValueType NewValue) { m_KeyValue.second = std::move(NewValue); }
+                // Write the results for the group in order...
+                for(int Index = 0; Index < GroupSize; ++Index)
+                {
+                    NodeType * const FoundNode =
+                        Searches[Index].m_CurrentNode->GetForwardPointer(0);
+                    const BatchKeyType<KeyIteratorType> &SearchKey = *Searches[Index].m_Key;
+                    *Output++ = (FoundNode && IsMatch(FoundNode->GetKey(), SearchKey))
+                        ? MakeIterator(FoundNode) : end();
+                }
+            }
 
-            // Public types...
-            public:
+            // Return output past the last result written...
+            return Output;
+        }
 
-                // Forward pointers type. By using an array instead of a linked
-                //  list we can minimize cache misses...
-                using ForwardPointersType = std::array<NodeType *, MaximumLevels>;
+        // Find the rightmost node whose key is less than the given key, or
+        //  not greater than it if Inclusive, which may be the header if there
+        //  are none, on the given lowest level. If UpdatedPointers is
+        //  provided, it receives the rightmost such node on every level from
+        //  the highest down to the lowest. The end of each level is a null
+        //  forward pointer, so the innermost loop only has to check for null
+        //  before calling the user's comparison object and never compares
+        //  against the header...
+        template <bool Inclusive = false, typename OtherKeyType>
+        NodeType *SeekPredecessor(
+            const OtherKeyType &Key,
+            typename NodeType::ForwardPointersType * const UpdatedPointers = nullptr,
+            const int LowestLevel = 0) const
+        {
+            // Start with the header node...
+            NodeType *CurrentNode = m_Header;
 
-            // Protected attributes...
-            protected:
+            // Examine each level, from the highest level to the lowest...
+            for(int CurrentLevel = m_HighestLevel;
+                CurrentLevel >= LowestLevel;
+              --CurrentLevel)
+            {
+                // Keep moving right on this level as far as we can without
+                //  overshooting the location the key should be located, if it
+                //  exists...
+                NodeType *NextNode = CurrentNode->GetForwardPointer(CurrentLevel);
+                while(NextNode)
+                {
+                    // If requested, while the comparison on the next node
+                    //  runs, fetch the node after it on this level in case we
+                    //  advance, and the node after us on the next level down
+                    //  in case we descend instead...
+                    if constexpr(TraitsType::Prefetch)
+                    {
+                        PrefetchNode(NextNode->GetForwardPointer(CurrentLevel));
+                        if(CurrentLevel > 0)
+                            PrefetchNode(CurrentNode->GetForwardPointer(CurrentLevel - 1));
+                    }
+
+                    // Stop if moving right would overshoot...
+                    if(!IsBefore<Inclusive>(NextNode->GetKey(), Key))
+                        break;
 
-                // Key and value pair...
-                KeyValueType            m_KeyValue;
+                    // Advance...
+                    CurrentNode = NextNode;
+                    NextNode    = CurrentNode->GetForwardPointer(CurrentLevel);
+                    m_Statistics.CountHop(CurrentLevel);
+                }
 
-                // List of forward pointers, default initialized to nullptr...
-                ForwardPointersType     m_ForwardPointers;
-        };
+                // Count the level examined...
+                m_Statistics.CountLevel();
 
-    // Protected methods...
-    protected:
+                // Check invariants...
 
-        // Select a random level. Useful when creating a new node...
-        int GetRandomLevel() noexcept
+                    // The node we are at should always be before the key,
+                    //  unless it's the header...
+                    assert((CurrentNode == m_Header) ||
+                           IsBefore<Inclusive>(CurrentNode->GetKey(), Key));
+
+                    // The next one over should never be, unless we've reached
+                    //  the end...
+                    assert(!NextNode || !IsBefore<Inclusive>(NextNode->GetKey(), Key));
+
+                // Save the node on the left on this level, if requested...
+                if(UpdatedPointers)
+                    (*UpdatedPointers)[CurrentLevel] = CurrentNode;
+            }
+
+            // Return the rightmost node less than the key...
+            return CurrentNode;
+        }
+
+        // Find where the given key belongs, returning the node that already
+        //  has an equivalent key if there is one. Otherwise return null, with
+        //  UpdatedPointers holding the node to the left of where the key
+        //  belongs on every level up to the list's highest. If the list
+        //  allows duplicate keys, a key belongs after every equivalent one
+        //  and null is always returned. Keys greater than every other in the
+        //  list, or not less with duplicates, belong after the rightmost
+        //  nodes without searching...
+        template <typename OtherKeyType>
+        NodeType *SeekInsertionPoint(
+            const OtherKeyType &Key,
+            typename NodeType::ForwardPointersType &UpdatedPointers) const
         {
-            // We want a random distribution in the range of [0, 1)...
-            std::uniform_real_distribution<float> RandomDistribution(0.0f, 1.0f);
+            // If the key belongs after the last node, as with monotone
+            //  appends, then the rightmost node on each level is already known
+            //  to be the node to its left...
+            if(m_RightmostNodes[0] != m_Header &&
+               IsBefore<TraitsType::DuplicateKeys>(m_RightmostNodes[0]->GetKey(), Key))
+            {
+                UpdatedPointers = m_RightmostNodes;
+                return nullptr;
+            }
 
-            // Start with a single level...
-            int CurrentLevel = 0;
+            // With duplicates, the key belongs after the rightmost node not
+            //  greater than it on each level...
+            if constexpr(TraitsType::DuplicateKeys)
+            {
+                SeekPredecessor<true>(Key, &UpdatedPointers);
+                return nullptr;
+            }
+
+            // Otherwise find the node on the left of the location on each
+            //  level. The next node is either the key's or where it belongs...
+            NodeType * const NextNode =
+                SeekPredecessor(Key, &UpdatedPointers)->GetForwardPointer(0);
+
+            // Return it if it has the key...
+            if(NextNode && IsMatch(NextNode->GetKey(), Key))
+                return NextNode;
+
+            // Otherwise signal the key does not exist...
+            else
+                return nullptr;
+        }
 
-            // Keep flipping a coin until it hits tails, but never increasing
-            //  the level of the new node passed the maximum permissible...
-            while(
-                (RandomDistribution(m_RandomGenerator) < 0.5f) &&
-                (CurrentLevel < (MaximumLevels - 1)))
+        // Find the node on the left of the given one, which must be in the
+        //  list, on every level up to the list's highest. Among duplicates, a
+        //  search for its key only finds the nodes on the left of the first,
+        //  so any between that and the given node are walked past on the
+        //  bottom level, each becoming the left node on its own levels...
+        void SeekNode(
+            const NodeType * const Node,
+            typename NodeType::ForwardPointersType &UpdatedPointers) const noexcept
+        {
+            SeekPredecessor(Node->GetKey(), &UpdatedPointers);
+            if constexpr(TraitsType::DuplicateKeys)
             {
-                // Increase the node's level...
-              ++CurrentLevel;
+                for(NodeType *CurrentNode = UpdatedPointers[0]->GetForwardPointer(0);
+                    CurrentNode != Node; CurrentNode = CurrentNode->GetForwardPointer(0))
+                {
+                    assert(CurrentNode);
+                    std::fill_n(UpdatedPointers.begin(), CurrentNode->GetLevel(), CurrentNode);
+                }
             }
+        }
 
-            // Return the proposed node's level...
-            return CurrentLevel;
+        // Insert the given key with a value constructed in place from the
+        //  remaining arguments if the key does not already exist. Return an
+        //  iterator to the key value pair with that key and whether a new pair
+        //  was inserted...
+        template <typename OtherKeyType, typename... ArgumentTypes>
+        std::pair<iterator, bool> TryEmplaceKey(OtherKeyType &&Key, ArgumentTypes &&... Arguments)
+        {
+            // Count this insertion...
+            OperationScopeType Scope(m_Statistics, SkipListOperation::Insert);
+
+            // Find where the key belongs...
+            typename NodeType::ForwardPointersType UpdatedPointers;
+            if(NodeType * const ExistingNode = SeekInsertionPoint(Key, UpdatedPointers))
+                return {MakeIterator(ExistingNode), false};
+
+            // It doesn't exist, so construct its key and value in place within
+            //  a new node...
+            NodeType * const NewNode = LinkNewNode(
+                UpdatedPointers,
+                GetRandomLevel(),
+                std::piecewise_construct,
+                std::forward_as_tuple(std::forward<OtherKeyType>(Key)),
+                std::forward_as_tuple(std::forward<ArgumentTypes>(Arguments)...));
+
+            // Return the new node...
+            return {MakeIterator(NewNode), true};
         }
 
-        // Compare two keys for logical less than...
-        bool IsLessThan(
-            const KeyType &LeftHandSide,
-            const KeyType &RightHandSide) const
+        // Link the given new node in after the given nodes on each level it
+        //  participates in, which must all be to its left and populated up to
+        //  the smaller of its level and the list's highest. Indexable lists,
+        //  and lists keeping checkpoints, need them populated up to the
+        //  list's highest regardless. Indexable lists may also be given each
+        //  of those nodes' ranks, counting the header as zero, if already
+        //  known...
+        void LinkNode(
+            typename NodeType::ForwardPointersType &UpdatedPointers,
+            NodeType * const NewNode,
+            [[maybe_unused]] std::array<size_type, MaximumLevels> * const Ranks = nullptr) noexcept
         {
-            // If the two keys refer to the same object, then axiomatically a
-            //  key cannot be less than itself...
-            if(&LeftHandSide == &RightHandSide)
-                return false;
+            // The new node's level...
+            const int NewLevel = NewNode->GetLevel() - 1;
 
-            // Treat the terminal node (largest possible key) as a special case
-            //  that is always greater than anything else. If it's on the right
-            //  side, then the expression is always true...
-            else if(&RightHandSide == &(m_End->GetKey()))
-                return true;
+            // Any finger a hinted insertion left may no longer be valid...
+            m_HintFingerValid = false;
 
-            // If the terminal node (largest possible key) is on the left side
-            //  then it can never be less than anything else, and the expression
-            //  is therefore always false...
-            else if(&LeftHandSide == &(m_End->GetKey()))
-                return false;
+            // The new level is higher than the current highest level node in
+            //  the list...
+            if(NewLevel > m_HighestLevel)
+            {
+                // Remember to update the header's forward pointers above the
+                //  previous highest level...
+                for(int CurrentLevel = m_HighestLevel + 1;
+                    CurrentLevel <= NewLevel;
+                  ++CurrentLevel)
+                {
+                    UpdatedPointers[CurrentLevel] = m_Header;
 
-            // If the header (smallest possible key) is on the right side then
-            //  it can never be less than anything else, and the expression is
-            //  therefore always false...
-            else if(&RightHandSide == &(m_Header->GetKey()))
-                return false;
+                    // The header skips everything on a new level...
+                    if constexpr(TraitsType::Indexable)
+                    {
+                        m_Header->SetWidth(CurrentLevel, m_Size + 1);
+                        if(Ranks)
+                            (*Ranks)[CurrentLevel] = 0;
+                    }
+                }
 
-            // If the header (smallest possible key) is on the left side then it
-            //  is always less than anything else, and the expression is
-            //  therefore always true...
-            else if(&LeftHandSide == &(m_Header->GetKey()))
-                return true;
+                // Remember that we've increased the highest level in the
+                //  list...
+                m_HighestLevel = NewLevel;
+            }
 
-            // For all other scenarios use the user's comparison object...
-            else
-                return m_LessThanComparison(LeftHandSide, RightHandSide);
+            // Divide each width the new node falls within...
+            if constexpr(TraitsType::Indexable)
+            {
+                if(Ranks)
+                    LinkWidths(UpdatedPointers, *Ranks, NewNode);
+                else
+                    LinkWidths(UpdatedPointers, NewNode);
+            }
+
+            // Splice pointers on every level the new node is linked into...
+            for(int CurrentLevel = 0; CurrentLevel <= NewLevel; ++CurrentLevel)
+            {
+                // Node to the right of the new one on this level, if any...
+                NodeType * const NextNode =
+                    UpdatedPointers[CurrentLevel]->GetForwardPointer(CurrentLevel);
+
+                // ...for the new node to point to the node to its right...
+                NewNode->SetForwardPointer(CurrentLevel, NextNode);
+
+                // ...and for the preceeding nodes that need to point to it...
+                UpdatedPointers[CurrentLevel]->SetForwardPointer(CurrentLevel, NewNode);
+
+                // If nothing follows on this level, it's now the rightmost...
+                if(!NextNode)
+                    m_RightmostNodes[CurrentLevel] = NewNode;
+            }
+
+            // Point the new node back to the node on its left, and the node
+            //  on its right back to it...
+            NewNode->SetBackPointer(UpdatedPointers[0]);
+            UpdateBackPointer(NewNode);
+
+            // It's a change since the last checkpoint...
+            MarkChanged(NewNode, UpdatedPointers);
+
+            // Update node count...
+          ++m_Size;
         }
 
-        // Compare two keys for logical less than or equal to...
-        bool IsLessThanOrEqual(
-            const KeyType &LeftHandSide,
-            const KeyType &RightHandSide) const
+        // Before the given new node is spliced in after the given nodes, split
+        //  the width of each one it falls beneath between it and the new
+        //  node, and widen the rest by one. Each node on the left's rank is
+        //  found by walking its level from the node on the left one level
+        //  up, which is only a few steps on average...
+        void LinkWidths(
+            const typename NodeType::ForwardPointersType &UpdatedPointers,
+            NodeType * const NewNode) noexcept
         {
-            // Less than...
-            if(IsLessThan(LeftHandSide, RightHandSide))
-                return true;
+            // Number of bottom level steps from the header to the node on the
+            //  left on each level...
+            std::array<size_type, MaximumLevels> Ranks;
+            size_type Rank = 0;
+            NodeType *CurrentNode = m_Header;
+            for(int CurrentLevel = m_HighestLevel; CurrentLevel >= 0; --CurrentLevel)
+            {
+                while(CurrentNode != UpdatedPointers[CurrentLevel])
+                {
+                    Rank += CurrentNode->GetWidth(CurrentLevel);
+                    CurrentNode = CurrentNode->GetForwardPointer(CurrentLevel);
+                }
+                Ranks[CurrentLevel] = Rank;
+            }
 
-            // Since we only have a user provided less than comparison object,
-            //  we can also use it to check for equivalence because
-            //  (A <= B) <--> (A < B) || (!(A < B) && !(B < A))
-            //  If the second part of the dysjunction is true, then the keys
-            //  must be logically equivalent...
-            if(!IsLessThan(LeftHandSide, RightHandSide) &&
-               !IsLessThan(RightHandSide, LeftHandSide))
-                return true;
+            // Divide them...
+            LinkWidths(UpdatedPointers, Ranks, NewNode);
+        }
 
-            // In all other scenarios the left hand side must be greater than
-            //  the right...
-            return false;
+        // As above, given each node on the left's rank...
+        void LinkWidths(
+            const typename NodeType::ForwardPointersType &UpdatedPointers,
+            const std::array<size_type, MaximumLevels> &Ranks,
+            NodeType * const NewNode) noexcept
+        {
+            // The new node's level...
+            const int NewLevel = NewNode->GetLevel() - 1;
+
+            // The new node's own rank...
+            const size_type NewRank = Ranks[0] + 1;
+
+            // Divide the width on each level it participates in, and widen
+            //  those it passes beneath...
+            for(int CurrentLevel = 0; CurrentLevel <= m_HighestLevel; ++CurrentLevel)
+            {
+                NodeType * const LeftNode = UpdatedPointers[CurrentLevel];
+                const size_type Width = LeftNode->GetWidth(CurrentLevel);
+                if(CurrentLevel <= NewLevel)
+                {
+                    const size_type LeftWidth = NewRank - Ranks[CurrentLevel];
+                    NewNode->SetWidth(CurrentLevel, Width - LeftWidth + 1);
+                    LeftNode->SetWidth(CurrentLevel, LeftWidth);
+                }
+                else
+                    LeftNode->SetWidth(CurrentLevel, Width + 1);
+            }
+        }
+
+        // Mark the given node, or the gap after it, as changed since the last
+        //  checkpoint, along with the span containing it on each level above
+        //  its own, which begins at the given node to its left on that level.
+        //  Does nothing unless the list keeps checkpoints...
+        void MarkChanged(
+            [[maybe_unused]] NodeType * const Node,
+            [[maybe_unused]] const typename NodeType::ForwardPointersType &UpdatedPointers) noexcept
+        {
+            if constexpr(TraitsType::Checkpoints)
+            {
+                const int Height = std::min(Node->GetLevel(), m_HighestLevel + 1);
+                for(int CurrentLevel = 0; CurrentLevel < Height; ++CurrentLevel)
+                    Node->MarkChanged(CurrentLevel);
+                for(int CurrentLevel = Height; CurrentLevel <= m_HighestLevel; ++CurrentLevel)
+                    UpdatedPointers[CurrentLevel]->MarkChanged(CurrentLevel);
+            }
+        }
+
+        // Forget every change marked within the span beginning at the given
+        //  node on the given level and ending at the given node, descending
+        //  into each marked span below it, exactly as WriteChanges() does...
+        void ForgetChanges(
+            NodeType * const Start,
+            const int Level,
+            const NodeType * const End) noexcept
+        {
+            for(NodeType *CurrentNode = Start; CurrentNode != End;
+                CurrentNode = CurrentNode->GetForwardPointer(Level))
+            {
+                if(Level && (CurrentNode == m_Header || CurrentNode->IsChanged(Level)))
+                    ForgetChanges(CurrentNode, Level - 1, CurrentNode->GetForwardPointer(Level));
+                CurrentNode->ClearChanged(Level);
+            }
+        }
+
+        // As above, but searching for the nodes to its left first...
+        void MarkChanged([[maybe_unused]] NodeType * const Node) noexcept
+        {
+            if constexpr(TraitsType::Checkpoints)
+            {
+                typename NodeType::ForwardPointersType UpdatedPointers;
+                SeekPredecessor(Node->GetKey(), &UpdatedPointers);
+                MarkChanged(Node, UpdatedPointers);
+            }
+        }
+
+        // Write every changed range beginning within the span beginning at the
+        //  given node on the given level and ending at the given node. On the
+        //  bottom level, each changed node begins a range running along it
+        //  until the next unchanged node, unless an earlier range already
+        //  covered it, which the given node tracks the end of. Above it, each
+        //  span marked as holding a change is descended into, as is each of
+        //  the header's, since its spans above the highest level aren't
+        //  marked when the list grows taller...
+        template <typename WriterType>
+        void WriteChanges(
+            WriterType &Writer,
+            const NodeType * const Start,
+            const int Level,
+            const NodeType * const End,
+            const NodeType *&WrittenUntil) const
+        {
+            for(const NodeType *CurrentNode = Start; CurrentNode != End;
+                CurrentNode = CurrentNode->GetForwardPointer(Level))
+            {
+                // Descend into each span holding a change...
+                if(Level)
+                {
+                    if(CurrentNode == m_Header || CurrentNode->IsChanged(Level))
+                        WriteChanges(
+                            Writer, CurrentNode, Level - 1, CurrentNode->GetForwardPointer(Level), WrittenUntil);
+                    continue;
+                }
+
+                // Skip unchanged nodes, and those an earlier range covered,
+                //  which are all before the end it tracks...
+                if(!CurrentNode->IsChanged(0) ||
+                   ((WrittenUntil != m_Header) &&
+                    (!WrittenUntil || IsLessThan(CurrentNode->GetKey(), WrittenUntil->GetKey()))))
+                    continue;
+
+                // Find the end of this run of changed nodes...
+                size_type Count = 0;
+                const NodeType *RunEnd = CurrentNode;
+                for(; RunEnd && RunEnd->IsChanged(0); RunEnd = RunEnd->GetForwardPointer(0))
+                {
+                    if(RunEnd != m_Header)
+                      ++Count;
+                }
+
+                // Write it, bounded by its first node unless that's the header,
+                //  and the unchanged node after it, if any...
+                Writer.BeginRange(
+                    (CurrentNode == m_Header) ? nullptr : &CurrentNode->GetKey(),
+                    RunEnd ? &RunEnd->GetKey() : nullptr,
+                    Count);
+                for(const NodeType *RunNode = CurrentNode; RunNode != RunEnd;
+                    RunNode = RunNode->GetForwardPointer(0))
+                {
+                    if(RunNode != m_Header)
+                        Writer.WriteKeyValue(RunNode->GetKeyValue());
+                }
+                WrittenUntil = RunEnd;
+            }
+        }
+
+        // Create a new node of the given level, constructing its key value
+        //  pair in place from the remaining arguments, and link it in as
+        //  above. Returns the new node...
+        template <typename... ArgumentTypes>
+        NodeType *LinkNewNode(
+            typename NodeType::ForwardPointersType &UpdatedPointers,
+            const int NewLevel,
+            ArgumentTypes &&... Arguments)
+        {
+            // Allocate the new node with a tower just tall enough for its
+            //  level and construct its key and value...
+            NodeType * const NewNode = CreateNode(
+                NewLevel + 1, std::forward<ArgumentTypes>(Arguments)...);
+
+            // Link it in...
+            LinkNode(UpdatedPointers, NewNode);
+
+            // Return the new node...
+            return NewNode;
+        }
+
+        // If we keep back pointers, point the node following the given one on
+        //  the bottom level back to it. If nothing follows, the given node is
+        //  the tail, so point the header back to it instead...
+        void UpdateBackPointer([[maybe_unused]] NodeType * const Node) noexcept
+        {
+            if constexpr(TraitsType::BackPointers)
+            {
+                NodeType * const NextNode = Node->GetForwardPointer(0);
+                (NextNode ? NextNode : m_Header)->SetBackPointer(Node);
+            }
+        }
+
+        // Hint to the processor that the given node will be read soon. The
+        //  node may be null...
+        static void PrefetchNode([[maybe_unused]] const NodeType * const Node) noexcept
+        {
+        #if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(Node, 0, 3);
+        #endif
+        }
+
+        // Compare two keys for logical less than using the user's comparison
+        //  object. Neither key may belong to the header, since the header and
+        //  end of the list are handled structurally by the search instead...
+        template <typename LeftKeyType, typename RightKeyType>
+        bool IsLessThan(
+            const LeftKeyType &LeftHandSide,
+            const RightKeyType &RightHandSide) const
+        {
+            m_Statistics.CountComparison();
+            return m_LessThanComparison(LeftHandSide, RightHandSide);
+        }
+
+        // Check whether a node's key belongs before the given key during a
+        //  search. That's when it's less than the key, or also when it's
+        //  equivalent if the search is inclusive...
+        template <bool Inclusive, typename OtherKeyType>
+        bool IsBefore(const KeyType &NodeKey, const OtherKeyType &Key) const
+        {
+            if constexpr(Inclusive)
+                return !IsLessThan(Key, NodeKey);
+            else
+                return IsLessThan(NodeKey, Key);
+        }
+
+        // Check whether a node's key, already known not to be less than the
+        //  given key, matches it. Keys are equivalent when neither is less
+        //  than the other, so only the second half remains to be checked with
+        //  the comparison object, unless == may be used instead. Either way
+        //  keys need not provide ==...
+        template <typename OtherKeyType>
+        bool IsMatch(const KeyType &NodeKey, const OtherKeyType &Key) const
+        {
+            // Check invariants...
+            assert(!IsLessThan(NodeKey, Key));
+
+            if constexpr(UseEqualityOperator)
+                return NodeKey == Key;
+            else
+                return !IsLessThan(Key, NodeKey);
         }
 
     // Protected attributes...
@@ -712,8 +4771,16 @@ class SkipList
         // Header node...
         NodeType                       *m_Header;
 
-        // Terminal node...
-        NodeType                       *m_End;
+        // Rightmost node on each level, which is the header on any level with
+        //  no other nodes. The bottom level's is the tail of the list...
+        typename NodeType::ForwardPointersType  m_RightmostNodes;
+
+        // Nodes to the left of the last key a hinted insertion searched for
+        //  on every level, and their ranks, counting the header as zero.
+        //  Only valid until anything else changes the list...
+        typename NodeType::ForwardPointersType  m_HintFinger;
+        std::array<size_type, MaximumLevels>    m_HintFingerRanks;
+        bool                                    m_HintFingerValid;
 
         // Current highest level of any node, beginning counting levels at
         //  zero...
@@ -722,14 +4789,22 @@ class SkipList
         // Less than comparison operator...
         LessThanComparisonType          m_LessThanComparison;
 
-        // Random device to feed the generator...
-        std::random_device              m_RandomDevice;
+        // Counters behind the statistics, if we keep them. Searches count
+        //  even though they don't otherwise modify the list...
+        mutable CountersType            m_Statistics;
 
-        // Mersenne Twister random generator from the random device...
-        std::mt19937                    m_RandomGenerator;
+        // Chooses new nodes' levels...
+        LevelGeneratorType              m_LevelGenerator;
 
         // Total number of elements...
         size_type                       m_Size;
+
+        // Total levels in the tower of every node after the header, for
+        //  MemoryUsage()...
+        size_type                       m_TowerLevels;
+
+        // Allocator for every node other than the header...
+        AllocatorType                   m_Allocator;
 };
 
 // Multiple include protection...
@@ -1,20 +1,77 @@
 // Includes...
 
     // System...
+    #include <algorithm>
     #include <cassert>
+    #include <cstdint>
+    #include <iterator>
     #include <iostream>
+    #include <limits>
     #include <map>
+    #include <memory>
     #include <random>
     #include <string>
+    #include <string_view>
+    #include <thread>
     #include <utility>
     #include <vector>
 
     // Our headers...
+    #include "AdaptiveSkipList.h"
+    #include "ConcurrentSkipList.h"
+    #include "MappedSkipList.h"
     #include "SkipList.h"
+    #include "UnrolledSkipList.h"
 
 // Use the standard namespace...
 using namespace std;
 
+// Key with neither a default constructor nor an equality operator, so it can
+//  only be compared with the comparison object below...
+struct OpaqueKeyType
+{
+    explicit OpaqueKeyType(const int Value) : m_Value(Value) {}
+    int m_Value;
+};
+struct OpaqueLessType
+{
+    bool operator()(const OpaqueKeyType &Left, const OpaqueKeyType &Right) const
+    {
+        return Left.m_Value < Right.m_Value;
+    }
+};
+
+// Value without a default constructor, counting how many are alive...
+struct CountedValueType
+{
+    explicit CountedValueType(const int Value) : m_Value(Value) { ++m_Alive; }
+    CountedValueType(const CountedValueType &Other) : m_Value(Other.m_Value) { ++m_Alive; }
+    CountedValueType &operator=(const CountedValueType &) = default;
+   ~CountedValueType() { --m_Alive; }
+    int m_Value;
+    static inline int m_Alive = 0;
+};
+
+// Traits for an indexable list that also keeps statistics...
+struct MeasuredTraits : SkipListIndexableTraits
+{
+    static constexpr bool Statistics = true;
+};
+
+// Traits for an indexable list that also keeps back pointers and checkpoints...
+struct CompleteTraits : SkipListIndexableTraits
+{
+    static constexpr bool BackPointers = true;
+    static constexpr bool Checkpoints = true;
+};
+
+// Traits for an indexable list allowing duplicate keys, with back pointers...
+struct IndexableMultimapTraits : SkipListMultimapTraits
+{
+    static constexpr bool BackPointers = true;
+    static constexpr bool Indexable = true;
+};
+
 // Entry point...
 int main()
 {
@@ -66,12 +123,2096 @@ int main()
     else
         cout << "Not found!" << endl;
 
+    cout << "Batch searching..." << endl;
+    {
+        // Keys to search for, some of which are absent, in unsorted order...
+        vector<int> BatchKeys = {42, -1, 7, MaximumInteger + 1, 99999, 1, 42};
+        vector<decltype(List)::iterator> Results;
+
+        // Checks each result is the same as a single search would find...
+        auto CheckResults = [&]
+        {
+            assert(Results.size() == BatchKeys.size());
+            for(size_t Index = 0; Index < BatchKeys.size(); ++Index)
+                assert(Results[Index] == List.Search(BatchKeys[Index]));
+        };
+
+        // Interleaved search...
+        List.SearchBatch(cbegin(BatchKeys), cend(BatchKeys), back_inserter(Results));
+        CheckResults();
+
+        // Finger search...
+        sort(begin(BatchKeys), end(BatchKeys));
+        Results.clear();
+        List.SearchBatch(cbegin(BatchKeys), cend(BatchKeys), back_inserter(Results));
+        CheckResults();
+
+        // Finger search until the keys fall out of order, then interleaved...
+        BatchKeys.insert(end(BatchKeys), {5, 3, 100, 2});
+        Results.clear();
+        List.SearchBatch(cbegin(BatchKeys), cend(BatchKeys), back_inserter(Results));
+        CheckResults();
+
+        // Finger search over every key...
+        vector<int> SortedKeys(RandomIntegers);
+        sort(begin(SortedKeys), end(SortedKeys));
+        Results.clear();
+        List.SearchBatch(cbegin(SortedKeys), cend(SortedKeys), back_inserter(Results));
+        for(size_t Index = 0; Index < SortedKeys.size(); ++Index)
+            assert(Results[Index]->first == SortedKeys[Index]);
+    }
+
+    cout << "Range queries..." << endl;
+    {
+        // Bounds of a present key...
+        assert(List.LowerBound(500)->first == 500);
+        assert(List.UpperBound(500)->first == 501);
+        assert(List.UpperBound(MaximumInteger) == cend(List));
+        assert(List.LowerBound(0)->first == 1);
+
+        // Equal range of a present and an absent key...
+        [[maybe_unused]] const auto [First, Last] = List.EqualRange(700);
+        assert(First->first == 700 && Last->first == 701);
+        [[maybe_unused]] const auto [Empty, AlsoEmpty] = List.EqualRange(MaximumInteger + 1);
+        assert(Empty == AlsoEmpty && Empty == cend(List));
+
+        // Range view over [100, 200)...
+        int ExpectedKey = 100;
+        for([[maybe_unused]] const auto &[Key, Value] : List.Range(100, 200))
+        {
+            assert(Key == ExpectedKey);
+          ++ExpectedKey;
+        }
+        assert(ExpectedKey == 200);
+        assert(List.Range(300, 300).IsEmpty());
+
+        // Visitor forms, including stopping early...
+        [[maybe_unused]] long Sum = 0;
+        assert(List.Range(100, 200, [&Sum](const auto &KeyValue) { Sum += KeyValue.first; }) == 100);
+        assert(Sum == 14950);
+        assert(List.LowerBound(10, [](const auto &KeyValue) { return KeyValue.first < 19; }) == 10);
+        assert(List.UpperBound(MaximumInteger - 5, [](const auto &) {}) == 5);
+        assert(List.EqualRange(42, [](const auto &KeyValue) { assert(KeyValue.first == 42); }) == 1);
+    }
+
+    cout << "Deleting even keys..." << endl;
+    for(int Key = 2; Key <= MaximumInteger; Key += 2)
+    {
+        [[maybe_unused]] const size_t Deleted = List.Delete(Key);
+        assert(Deleted == 1);
+    }
+
+    // Check size and that only the odd keys remain...
+    assert(List.GetSize() == MaximumInteger / 2);
+    assert(List.Search(4) == cend(List));
+    assert(List.Search(5) != cend(List));
+    [[maybe_unused]] const size_t DeletedAgain = List.Delete(4);
+    assert(DeletedAgain == 0);
+
     cout << "Clearing..." << endl;
     List.Clear();
 
     // Check size...
     assert(List.GetSize() == 0);
 
+    // Check building from a sorted range, with both level assignments...
+    for(const auto LevelAssignment : {SkipListLevelAssignment::Random, SkipListLevelAssignment::Balanced})
+    {
+        // Sorted pairs, with a duplicate key whose last value should win...
+        vector<pair<int, string>> SortedPairs;
+        for(int Key = 1; Key <= MaximumInteger; ++Key)
+            SortedPairs.emplace_back(Key, to_string(Key));
+        SortedPairs.emplace_back(MaximumInteger, "Last");
+
+        // Build the list from the first half, then append the second...
+        const auto Middle = begin(SortedPairs) + MaximumInteger / 2;
+        SkipList<int, string> SortedList(
+            SkipListFromSortedRange, begin(SortedPairs), Middle, LevelAssignment);
+        SortedList.BulkLoad(Middle, end(SortedPairs), LevelAssignment);
+
+        // Check it holds every key in order...
+        assert(SortedList.GetSize() == MaximumInteger);
+        int ExpectedKey = 1;
+        for([[maybe_unused]] const auto &[Key, Value] : SortedList)
+        {
+            assert(Key == ExpectedKey);
+          ++ExpectedKey;
+        }
+        assert(SortedList.Search(MaximumInteger)->second == "Last");
+
+        // It should also still support the usual operations...
+        assert(SortedList.Search(12345)->second == "12345");
+        [[maybe_unused]] const size_t Deleted = SortedList.Delete(12345);
+        assert(Deleted == 1);
+        SortedList.Insert(12345, "Again");
+        assert(SortedList.Search(12345)->second == "Again");
+    }
+
+    // Check appending at the tail and inserting with hints...
+    {
+        // Monotone appends through the ordinary insertion, which should use
+        //  the tail...
+        SkipList<int, string> HintedList;
+        for(int Key = 0; Key < MaximumInteger; Key += 10)
+            HintedList.Insert(Key, to_string(Key));
+
+        // Deleting the last key should leave the tail correct...
+        [[maybe_unused]] const size_t Deleted = HintedList.Delete(MaximumInteger - 10);
+        assert(Deleted == 1);
+        HintedList.Insert(MaximumInteger, to_string(MaximumInteger));
+
+        // Fill in each gap in order, hinting with the previous insertion...
+        auto Hint = HintedList.begin();
+        for(int Key = 1; Key < MaximumInteger; ++Key)
+            Hint = HintedList.Insert(Hint, Key, to_string(Key));
+
+        // Wrong hints and end hints should still insert or update...
+        [[maybe_unused]] const auto Wrong = HintedList.Insert(HintedList.begin(), MaximumInteger - 10, "Wrong");
+        assert(Wrong->second == "Wrong");
+        [[maybe_unused]] const auto Last = HintedList.Insert(HintedList.end(), MaximumInteger + 1, "Last");
+        assert(Last->second == "Last");
+        [[maybe_unused]] const auto Three = HintedList.Insert(HintedList.end(), 3, "Three");
+        assert(Three->second == "Three");
+
+        // Check every key is present in order...
+        assert(HintedList.GetSize() == static_cast<size_t>(MaximumInteger + 2));
+        int ExpectedKey = 0;
+        for([[maybe_unused]] const auto &[Key, Value] : HintedList)
+        {
+            assert(Key == ExpectedKey);
+          ++ExpectedKey;
+        }
+    }
+
+    // Check in place construction and heterogeneous lookup...
+    {
+        // List of strings with a transparent comparison object...
+        SkipList<string, vector<int>, less<>> StringList;
+
+        // Emplace constructs the pair, but never replaces an existing one...
+        [[maybe_unused]] const bool AlphaEmplaced = StringList.Emplace("Alpha", vector<int>{1}).second;
+        [[maybe_unused]] const bool AlphaReplaced = StringList.Emplace("Alpha", vector<int>{2}).second;
+        assert(AlphaEmplaced && !AlphaReplaced);
+        assert(StringList.Search(string("Alpha"))->second.front() == 1);
+
+        // TryEmplace only constructs the value when inserting...
+        [[maybe_unused]] const auto [BetaIterator, BetaInserted] = StringList.TryEmplace(string("Beta"), 3, 7);
+        assert(BetaInserted && BetaIterator->second.size() == 3);
+        [[maybe_unused]] const bool BetaReplaced = StringList.TryEmplace(string_view("Beta"), 5).second;
+        [[maybe_unused]] const bool GammaInserted = StringList.TryEmplace(string_view("Gamma"), 2).second;
+        assert(!BetaReplaced && GammaInserted);
+
+        // Lookups, insertions, and deletions by string_view...
+        assert(StringList.Search(string_view("Beta"))->second.size() == 3);
+        assert(StringList.Search(string_view("Delta")) == StringList.end());
+        StringList.Insert(string_view("Delta"), vector<int>{4});
+        StringList.Insert(string_view("Alpha"), vector<int>{5});
+        assert(StringList.Search("Alpha")->second.front() == 5);
+        [[maybe_unused]] const size_t GammaDeleted = StringList.Delete(string_view("Gamma"));
+        [[maybe_unused]] const size_t GammaDeletedAgain = StringList.Delete(string_view("Gamma"));
+        assert(GammaDeleted == 1 && GammaDeletedAgain == 0);
+        assert(StringList.GetSize() == 3);
+
+        // Range queries by string_view...
+        assert(StringList.Range(string_view("B"), string_view("E"), [](const auto &) {}) == 2);
+        assert(StringList.LowerBound(string_view("C"))->first == "Delta");
+
+        // Batches of string_view, sorted and not...
+        const vector<string_view> Views = {"Alpha", "Beta", "Delta", "Omega", "Beta", "Aardvark"};
+        vector<decltype(StringList)::iterator> Found;
+        StringList.SearchBatch(Views.cbegin(), Views.cend(), back_inserter(Found));
+        assert(Found.size() == Views.size());
+        for(size_t Index = 0; Index < Views.size(); ++Index)
+            assert(Found[Index] == StringList.Search(Views[Index]));
+    }
+
+    // Check both the standard allocator adaptor and the pool allocator's bulk
+    //  release of trivially destructible nodes...
+    {
+        // List backed by std::allocator...
+        SkipList<int, string, less<int>, 16, SkipListStandardAllocator<>> StandardList;
+        for(const int Key : RandomIntegers)
+            StandardList.Insert(Key, to_string(Key));
+        assert(StandardList.GetSize() == MaximumInteger);
+        [[maybe_unused]] const size_t Deleted = StandardList.Delete(7);
+        assert(Deleted == 1);
+        assert(StandardList.Search(8)->second == "8");
+
+        // List whose nodes can all be released at once...
+        SkipList<int, int> TrivialList;
+        for(int Pass = 0; Pass < 2; ++Pass)
+        {
+            for(const int Key : RandomIntegers)
+                TrivialList.Insert(Key, Key);
+            assert(TrivialList.GetSize() == MaximumInteger);
+            assert(TrivialList.Search(42)->second == 42);
+            TrivialList.Clear();
+            assert(TrivialList.GetSize() == 0);
+            assert(TrivialList.begin() == TrivialList.end());
+        }
+    }
+
+    // Check the level generator policies...
+    {
+        // Deterministic generators always draw the same levels, and a seeded
+        //  one the same as another with the same seed...
+        SkipListLevelGenerator<2, true> First, Second;
+        SkipListLevelGenerator<4> Seeded(7), AlsoSeeded(7);
+        for(int Index = 0; Index < 1000; ++Index)
+        {
+            [[maybe_unused]] const int FirstLevel = First.GetLevel(16);
+            [[maybe_unused]] const int SecondLevel = Second.GetLevel(16);
+            assert(FirstLevel == SecondLevel);
+            [[maybe_unused]] const int Level = Seeded.GetLevel(8);
+            [[maybe_unused]] const int AlsoLevel = AlsoSeeded.GetLevel(8);
+            assert(Level == AlsoLevel && Level >= 0 && Level < 8);
+        }
+
+        // Lists promoting with a probability of one quarter, and with a
+        //  deterministic generator...
+        struct QuarterTraits : SkipListDefaultTraits
+        {
+            using LevelGeneratorType = SkipListLevelGenerator<4>;
+        };
+        SkipList<int, int, less<int>, 16, SkipListPoolAllocator<16>, QuarterTraits> QuarterList;
+        SkipList<int, int, less<int>, 16, SkipListPoolAllocator<16>, SkipListDeterministicTraits>
+            DeterministicList(less<int>(), {}, SkipListLevelGenerator<2, true>(42));
+        for(const int Key : RandomIntegers)
+        {
+            QuarterList.Insert(Key, Key);
+            DeterministicList.Insert(Key, Key);
+        }
+        assert(QuarterList.GetSize() == MaximumInteger && DeterministicList.GetSize() == MaximumInteger);
+        assert(QuarterList.Search(123)->second == 123 && DeterministicList.Search(321)->second == 321);
+        assert(equal(QuarterList.begin(), QuarterList.end(), DeterministicList.begin()));
+
+        // Bulk loading balances levels by the generator's own denominator...
+        static_assert(SkipListPromotionDenominator<SkipListLevelGenerator<4>>::value == 4);
+        vector<pair<int, int>> QuarterPairs;
+        for(int Key = 1; Key <= MaximumInteger; ++Key)
+            QuarterPairs.emplace_back(Key, Key);
+        QuarterList.Clear();
+        QuarterList.BulkLoad(cbegin(QuarterPairs), cend(QuarterPairs));
+        assert(equal(QuarterList.begin(), QuarterList.end(), DeterministicList.begin()));
+    }
+
+    // Check bidirectional iteration with back pointers...
+    {
+        // List keeping back pointers, with the last key found in constant
+        //  time...
+        SkipList<int, string, less<int>, 16, SkipListPoolAllocator<16>, SkipListBackPointerTraits> BackList;
+        assert(BackList.Last() == BackList.end() && BackList.rbegin() == BackList.rend());
+        for(const int Key : RandomIntegers)
+            BackList.Insert(Key, to_string(Key));
+        assert(BackList.Last()->first == MaximumInteger);
+        assert(prev(BackList.end())->first == MaximumInteger);
+
+        // Checks reverse iteration visits every key in descending order...
+        auto CheckReverse = [&BackList](const int Expected)
+        {
+            int Count = 0;
+            [[maybe_unused]] int PreviousKey = numeric_limits<int>::max();
+            for(auto Iterator = BackList.crbegin(); Iterator != BackList.crend(); ++Iterator, ++Count)
+            {
+                assert(Iterator->first < PreviousKey);
+                PreviousKey = Iterator->first;
+            }
+            assert(Count == Expected);
+        };
+        CheckReverse(MaximumInteger);
+
+        // Deleting, including the first and last keys, hinted and transparent
+        //  insertion, and appending must all keep back pointers correct...
+        for(int Key = 2; Key <= MaximumInteger; Key += 3)
+        {
+            [[maybe_unused]] const size_t Deleted = BackList.Delete(Key);
+            assert(Deleted == 1);
+        }
+        [[maybe_unused]] const size_t LastDeleted = BackList.Delete(MaximumInteger);
+        assert(LastDeleted == 1);
+        assert(BackList.Last()->first == MaximumInteger - 1);
+        BackList.Insert(BackList.end(), MaximumInteger + 5, "Tail");
+        BackList.Insert(BackList.begin(), 1, "One");
+        [[maybe_unused]] const bool Emplaced = BackList.Emplace(MaximumInteger + 6, "Emplaced").second;
+        assert(Emplaced);
+        assert(BackList.Last()->second == "Emplaced");
+        const int Remaining = static_cast<int>(BackList.GetSize());
+        CheckReverse(Remaining);
+
+        // Decrementing walks backwards from any position...
+        auto Iterator = BackList.Search(501);
+        [[maybe_unused]] const auto Decremented = --Iterator;
+        [[maybe_unused]] const auto BeforeDecrementing = Iterator--;
+        assert(Decremented->first == 499 && BeforeDecrementing->first == 499 && Iterator->first == 498);
+
+        // Building from a sorted range and clearing...
+        vector<pair<int, string>> SortedPairs;
+        for(int Key = 1; Key <= 1000; ++Key)
+            SortedPairs.emplace_back(Key, to_string(Key));
+        BackList.Clear();
+        assert(BackList.Last() == BackList.end() && BackList.rbegin() == BackList.rend());
+        BackList.BulkLoad(cbegin(SortedPairs), cend(SortedPairs));
+        assert(equal(BackList.crbegin(), BackList.crend(), SortedPairs.crbegin(),
+            [](const auto &Left, const auto &Right) { return Left.first == Right.first; }));
+    }
+
+    // Check keys and values that can't be default constructed, and keys that
+    //  can't be compared with ==. The header constructs neither...
+    {
+        SkipList<OpaqueKeyType, CountedValueType, OpaqueLessType> OpaqueList;
+        assert(CountedValueType::m_Alive == 0);
+        for(int Key = 0; Key < 1000; ++Key)
+            OpaqueList.Insert(OpaqueKeyType(Key), CountedValueType(Key * 2));
+        assert(CountedValueType::m_Alive == 1000);
+        assert(OpaqueList.Search(OpaqueKeyType(21))->second.m_Value == 42);
+        assert(OpaqueList.Search(OpaqueKeyType(1000)) == OpaqueList.end());
+        [[maybe_unused]] const size_t Deleted = OpaqueList.Delete(OpaqueKeyType(21));
+        [[maybe_unused]] const size_t DeletedAgain = OpaqueList.Delete(OpaqueKeyType(21));
+        assert(Deleted == 1 && DeletedAgain == 0);
+        [[maybe_unused]] const bool Emplaced = OpaqueList.TryEmplace(OpaqueKeyType(21), 7).second;
+        assert(Emplaced);
+        assert(OpaqueList.Search(OpaqueKeyType(21))->second.m_Value == 7);
+        OpaqueList.Clear();
+        assert(CountedValueType::m_Alive == 0);
+    }
+
+    // Check positional access in an indexable list...
+    {
+        // Indexable list...
+        SkipList<int, string, less<int>, 16, SkipListPoolAllocator<16>, SkipListIndexableTraits> IndexList;
+        assert(IndexList.At(0) == IndexList.end() && IndexList.Rank(1) == 0);
+        for(const int Key : RandomIntegers)
+            IndexList.Insert(Key, to_string(Key));
+
+        // Checks every position holds the next key in order, and that each
+        //  key's rank is its position...
+        auto CheckPositions = [&IndexList]()
+        {
+            size_t Index = 0;
+            for(auto Iterator = IndexList.cbegin(); Iterator != IndexList.cend(); ++Iterator, ++Index)
+            {
+                assert(IndexList.At(Index) == Iterator);
+                assert(IndexList.Rank(Iterator->first) == Index);
+            }
+            assert(Index == IndexList.GetSize() && IndexList.At(Index) == IndexList.end());
+        };
+        CheckPositions();
+        assert(IndexList.At(0)->first == 1 && IndexList.At(41)->first == 42);
+        assert(IndexList.Rank(MaximumInteger + 1) == IndexList.GetSize());
+
+        // Deleting, hinted insertion, and in place construction must all keep
+        //  the widths correct...
+        for(int Key = 2; Key <= MaximumInteger; Key += 3)
+        {
+            [[maybe_unused]] const size_t Deleted = IndexList.Delete(Key);
+            assert(Deleted == 1);
+        }
+        CheckPositions();
+        assert(IndexList.Rank(5) == 3 && IndexList.At(3)->first == 6);
+        auto Hint = IndexList.Search(4);
+        for(int Key = 5; Key < 2000; Key += 3)
+            Hint = IndexList.Insert(Hint, Key, "Hinted");
+        IndexList.Insert(IndexList.end(), MaximumInteger + 5, "Tail");
+        [[maybe_unused]] const bool Emplaced = IndexList.Emplace(MaximumInteger + 6, "Emplaced").second;
+        assert(Emplaced);
+        CheckPositions();
+
+        // Erasing a range in the middle, then to the end...
+        [[maybe_unused]] const size_t Size = IndexList.GetSize();
+        [[maybe_unused]] const int FirstErased = IndexList.At(100)->first;
+        [[maybe_unused]] const int LastKept = IndexList.At(5000)->first;
+        [[maybe_unused]] const size_t MiddleErased = IndexList.Erase(IndexList.At(100), IndexList.At(5000));
+        assert(MiddleErased == 4900);
+        assert(IndexList.GetSize() == Size - 4900 && IndexList.At(100)->first == LastKept);
+        assert(IndexList.Rank(LastKept) == 100 && IndexList.Search(FirstErased) == IndexList.end());
+        CheckPositions();
+        [[maybe_unused]] const size_t TailErased = IndexList.Erase(IndexList.At(1000), IndexList.end());
+        assert(TailErased == Size - 5900);
+        assert(IndexList.GetSize() == 1000);
+        CheckPositions();
+        IndexList.Insert(MaximumInteger, "Again");
+        CheckPositions();
+
+        // Building from a sorted range and clearing, then erasing the lot...
+        vector<pair<int, string>> SortedPairs;
+        for(int Key = 1; Key <= 1000; ++Key)
+            SortedPairs.emplace_back(Key, to_string(Key));
+        IndexList.Clear();
+        IndexList.BulkLoad(cbegin(SortedPairs), cend(SortedPairs));
+        CheckPositions();
+        IndexList.Insert(500, "Replaced");
+        IndexList.Delete(1);
+        CheckPositions();
+        [[maybe_unused]] const size_t AllErased = IndexList.Erase(IndexList.begin(), IndexList.end());
+        assert(AllErased == 999 && IndexList.GetSize() == 0);
+        assert(IndexList.begin() == IndexList.end() && IndexList.At(0) == IndexList.end());
+        IndexList.Insert(7, "Seven");
+        CheckPositions();
+
+        // Erasing a range from a list that isn't indexable...
+        SkipList<int, int> PlainList;
+        for(int Key = 0; Key < 1000; ++Key)
+            PlainList.Insert(Key, Key);
+        [[maybe_unused]] const size_t PlainErased = PlainList.Erase(PlainList.Search(10), PlainList.Search(990));
+        assert(PlainErased == 980);
+        assert(PlainList.GetSize() == 20 && next(PlainList.Search(9))->first == 990);
+        [[maybe_unused]] const size_t NoneErased = PlainList.Erase(PlainList.begin(), PlainList.begin());
+        assert(NoneErased == 0);
+    }
+
+    // Check the statistics kept...
+    {
+        // List keeping statistics...
+        SkipList<int, int, less<int>, 16, SkipListPoolAllocator<16>, SkipListStatisticsTraits> StatisticsList;
+        for(int Key = 0; Key < 1000; ++Key)
+            StatisticsList.Insert(Key * 2, Key);
+        for(int Key = 0; Key < 2000; ++Key)
+            StatisticsList.Search(Key);
+        for(int Key = 0; Key < 500; ++Key)
+            StatisticsList.Delete(Key * 4);
+
+        // Every operation should be counted, with paths at least as long as
+        //  the levels examined...
+        SkipListStatistics Statistics = StatisticsList.GetStatistics();
+        assert(Statistics.Operations[static_cast<size_t>(SkipListOperation::Insert)] == 1000);
+        assert(Statistics.Operations[static_cast<size_t>(SkipListOperation::Search)] == 2000);
+        assert(Statistics.Operations[static_cast<size_t>(SkipListOperation::Delete)] == 500);
+        assert(Statistics.GetAveragePathLength(SkipListOperation::Search) >= 1.0);
+        assert(Statistics.Comparisons > 0 && Statistics.Hops.size() == 16 && Statistics.Hops[0] > 0);
+
+        // The histogram should account for every node, and the shape of the
+        //  list should match...
+        size_t Nodes = 0;
+        [[maybe_unused]] int Highest = 0;
+        for(size_t Height = 0; Height < Statistics.LevelHistogram.size(); ++Height)
+        {
+            Nodes += Statistics.LevelHistogram[Height];
+            if(Statistics.LevelHistogram[Height])
+                Highest = static_cast<int>(Height);
+        }
+        assert(Nodes == 500 && Statistics.Size == 500);
+        assert(Statistics.HighestLevel == Highest);
+        assert(Statistics.BytesPerEntry > sizeof(pair<int, int>));
+
+        // Resetting clears the counters but not the shape...
+        StatisticsList.ResetStatistics();
+        Statistics = StatisticsList.GetStatistics();
+        assert(Statistics.Comparisons == 0 && Statistics.Operations[0] == 0 && Statistics.Size == 500);
+        assert(Statistics.GetAveragePathLength(SkipListOperation::Search) == 0.0);
+
+        // A run of hinted insertions in the middle of a list, each hinted at
+        //  the key it follows, should take about as many steps at any size,
+        //  with or without widths to maintain above the new nodes...
+        [[maybe_unused]] auto HintedPathLength = [](auto &&HintedList, const int Size)
+        {
+            for(int Key = 0; Key < Size; ++Key)
+                HintedList.Insert(Key * 2, Key);
+            HintedList.ResetStatistics();
+            for(int Key = Size + 1; Key < Size + 4000; Key += 2)
+                HintedList.Insert(HintedList.Search(Key - 1), Key, Key);
+            return HintedList.GetStatistics().GetAveragePathLength(SkipListOperation::Insert);
+        };
+        using HintedListType [[maybe_unused]] =
+            SkipList<int, int, less<int>, 16, SkipListPoolAllocator<16>, SkipListStatisticsTraits>;
+        using HintedIndexedListType =
+            SkipList<int, int, less<int>, 16, SkipListPoolAllocator<16>, MeasuredTraits>;
+        assert(HintedPathLength(HintedListType(), 100000) < 6.0);
+        assert(HintedPathLength(HintedIndexedListType(), 100000) < 8.0);
+
+        // Hinted insertions resuming from where the previous one left off
+        //  must notice anything else changing the list in between...
+        HintedIndexedListType HintedList;
+        map<int, int> HintedExpected;
+        mt19937 HintedGenerator(7);
+        for(int Step = 0; Step < 20000; ++Step)
+        {
+            const int Key = static_cast<int>(HintedGenerator() % 2000);
+            switch(HintedGenerator() % 6)
+            {
+                case 0: HintedList.Delete(Key); HintedExpected.erase(Key); break;
+                case 1: HintedList.Insert(Key, Key); HintedExpected[Key] = Key; break;
+                default:
+                {
+                    auto Hint = HintedList.LowerBound(Key);
+                    Hint = (Hint == HintedList.begin()) ? HintedList.end() : HintedList.At(HintedList.Rank(Key) - 1);
+                    HintedList.Insert(Hint, Key, Key);
+                    HintedExpected[Key] = Key;
+                    break;
+                }
+            }
+            if(Step % 500 == 0)
+            {
+                assert(HintedList.GetSize() == HintedExpected.size());
+                size_t Index = 0;
+                for([[maybe_unused]] const auto &[ExpectedKey, ExpectedValue] : HintedExpected)
+                {
+                    assert(HintedList.At(Index)->first == ExpectedKey);
+                    assert(HintedList.Rank(ExpectedKey) == Index);
+                  ++Index;
+                }
+            }
+        }
+
+        // Keeping no statistics should cost no space...
+        static_assert(sizeof(SkipList<int, int>) <
+            sizeof(SkipList<int, int, less<int>, 16, SkipListPoolAllocator<16>, SkipListStatisticsTraits>));
+    }
+
+    // Check the memory usage breakdown...
+    {
+        // An empty list holds only its header, and its allocator nothing...
+        SkipList<int, int> MemoryList;
+        SkipListMemoryUsage Usage = MemoryList.MemoryUsage();
+        assert(Usage.Payloads == 0 && Usage.Widths == 0 && Usage.AllocatorSlack == 0);
+        assert(Usage.ForwardPointers == 16 * sizeof(void *));
+        assert(Usage.ListObject == sizeof(MemoryList));
+
+        // Payloads grow with every element, and the rest of the nodes' bytes
+        //  should match what the statistics find by walking the list...
+        SkipList<int, int, less<int>, 16, SkipListPoolAllocator<16>, MeasuredTraits> MeasuredList;
+        for(int Key = 0; Key < 1000; ++Key)
+            MeasuredList.Insert(Key, Key);
+        MeasuredList.Emplace(0, 0);
+        Usage = MeasuredList.MemoryUsage();
+        assert(Usage.Payloads == 1000 * sizeof(pair<const int, int>));
+        assert(Usage.Widths == Usage.ForwardPointers);
+        const SkipListStatistics Statistics = MeasuredList.GetStatistics();
+        assert(Usage.NodeHeaders + Usage.ForwardPointers + Usage.Widths + Usage.Payloads ==
+               static_cast<size_t>(Statistics.BytesPerEntry * 1000.0 + 0.5));
+        assert(Usage.AllocatorSlack < 64 * 1024);
+
+        // Deleting leaves the nodes' storage with the allocator to reuse, but
+        //  clearing releases it...
+        for(int Key = 0; Key < 1000; Key += 2)
+            MeasuredList.Delete(Key);
+        [[maybe_unused]] const SkipListMemoryUsage Deleted = MeasuredList.MemoryUsage();
+        assert(Deleted.Payloads == Usage.Payloads / 2);
+        assert(Deleted.GetTotal() == Usage.GetTotal());
+        MeasuredList.Clear();
+        Usage = MeasuredList.MemoryUsage();
+        assert(Usage.AllocatorSlack == 0 && Usage.Payloads == 0);
+
+        // The standard allocator adaptor only loses its rounding...
+        SkipList<int, int, less<int>, 16, SkipListStandardAllocator<>> StandardList;
+        for(int Key = 0; Key < 1000; ++Key)
+            StandardList.Insert(Key, Key);
+        Usage = StandardList.MemoryUsage();
+        assert(Usage.AllocatorSlack < 1000 * alignof(max_align_t));
+        StandardList.Clear();
+        assert(StandardList.MemoryUsage().AllocatorSlack == 0);
+    }
+
+    // Check saving a snapshot and mapping it back in...
+    {
+        // Where to save snapshots...
+        const string SnapshotPath = "Test.snapshot";
+
+        // Save a list of the even keys, with enough of them for several index
+        //  levels...
+        SkipList<int, double> SavedList;
+        for(int Key = 0; Key < 20000; Key += 2)
+            SavedList.Insert(Key, Key / 2.0);
+        SaveSnapshot(SavedList, SnapshotPath);
+
+        // Map it back, and check every key is present in order and every
+        //  odd one absent...
+        MappedSkipList<int, double> MappedList(SnapshotPath);
+        assert(MappedList.GetSize() == 10000);
+        int ExpectedKey = 0;
+        for([[maybe_unused]] const auto &KeyValue : MappedList)
+        {
+            assert(KeyValue.first == ExpectedKey && KeyValue.second == ExpectedKey / 2.0);
+            ExpectedKey += 2;
+        }
+        for(int Key = -1; Key <= 20001; ++Key)
+        {
+            [[maybe_unused]] const auto Iterator = MappedList.Search(Key);
+            assert((Iterator != MappedList.end()) == (Key >= 0 && Key < 20000 && Key % 2 == 0));
+            assert(MappedList.LowerBound(Key) == MappedList.LowerBound(Key + (Key & 1)));
+        }
+        assert(MappedList.LowerBound(19999) == MappedList.end());
+        assert(MappedList.LowerBound(-5)->first == 0);
+
+        // Range scans...
+        [[maybe_unused]] int Sum = 0;
+        assert(MappedList.Range(100, 200, [&](const auto &KeyValue) { Sum += KeyValue.first; }) == 50);
+        assert(Sum == (100 + 198) * 25);
+        assert(MappedList.Range(-10, 30000, [](const auto &KeyValue) { return KeyValue.first < 10; }) == 6);
+
+        // Bulk load a mutable list from the view...
+        SkipList<int, double> LoadedList(SkipListFromSortedRange, MappedList.begin(), MappedList.end());
+        assert(LoadedList.GetSize() == 10000 && LoadedList.Search(19998)->second == 9999.0);
+
+        // Saving replaces the old snapshot, and a moved view keeps its
+        //  mapping. Small lists have no index levels at all, and unrolled
+        //  lists save too...
+        UnrolledSkipList<int, double> SmallList;
+        for(int Key = 0; Key < 10; ++Key)
+            SmallList.Insert(Key, Key);
+        SaveSnapshot(SmallList, SnapshotPath);
+        MappedSkipList<int, double> SmallMappedList(SnapshotPath);
+        MappedSkipList<int, double> MovedList(move(SmallMappedList));
+        assert(SmallMappedList.GetSize() == 0);
+        assert(SmallMappedList.Search(0) == SmallMappedList.end());
+        assert(SmallMappedList.LowerBound(0) == SmallMappedList.end());
+        assert(SmallMappedList.Range(0, 10, [](const auto &) {}) == 0);
+        assert(MovedList.GetSize() == 10 && MovedList.Search(9)->second == 9.0);
+        assert(MovedList.Search(10) == MovedList.end());
+        assert(MappedList.Search(19998)->second == 9999.0);
+
+        // An empty list saves and maps fine too...
+        SavedList.Clear();
+        SaveSnapshot(SavedList, SnapshotPath);
+        MappedSkipList<int, double> EmptyList(SnapshotPath);
+        assert(EmptyList.GetSize() == 0 && EmptyList.begin() == EmptyList.end());
+        assert(EmptyList.Search(0) == EmptyList.end());
+
+        // Snapshots of other key or value types are rejected...
+        [[maybe_unused]] bool Rejected = false;
+        try { MappedSkipList<long long, double> MismatchedList(SnapshotPath); }
+        catch(const runtime_error &) { Rejected = true; }
+        assert(Rejected);
+        remove(SnapshotPath.c_str());
+
+        // As are missing files...
+        Rejected = false;
+        try { MappedSkipList<int, double> MissingList(SnapshotPath); }
+        catch(const system_error &) { Rejected = true; }
+        assert(Rejected);
+    }
+
+    // Check serialising and deserialising through streams...
+    {
+        // Sink appending to a string, and a source reading it back a few
+        //  bytes at a time...
+        string Stream;
+        auto Sink = [&](const void *Bytes, size_t Size)
+        {
+            Stream.append(static_cast<const char *>(Bytes), Size);
+        };
+        size_t Position = 0;
+        auto Source = [&](void *Bytes, size_t Size)
+        {
+            Size = min({Size, Stream.size() - Position, size_t(7)});
+            Stream.copy(static_cast<char *>(Bytes), Size, Position);
+            Position += Size;
+            return Size;
+        };
+
+        // Round trip strings in small chunks...
+        SkipList<int, string> SourceList;
+        for(int Key = -500; Key < 500; ++Key)
+            SourceList.Insert(Key, to_string(Key * 3));
+        SourceList.Serialize(Sink, 64);
+        SkipList<int, string> RestoredList;
+        RestoredList.Insert(10000, "Replaced");
+        RestoredList.Deserialize(Source);
+        assert(RestoredList.GetSize() == 1000 && RestoredList.Search(10000) == RestoredList.end());
+        int ExpectedKey = -500;
+        for([[maybe_unused]] const auto &KeyValue : RestoredList)
+        {
+            assert(KeyValue.first == ExpectedKey && KeyValue.second == to_string(ExpectedKey * 3));
+          ++ExpectedKey;
+        }
+
+        // Small integers encode as a byte or two each...
+        SkipList<int64_t, uint64_t> IntegerList;
+        for(int64_t Key = -50; Key < 50; ++Key)
+            IntegerList.Insert(Key, static_cast<uint64_t>(Key + 50));
+        IntegerList.Insert(numeric_limits<int64_t>::min(), numeric_limits<uint64_t>::max());
+        Stream.clear();
+        IntegerList.Serialize(Sink);
+        assert(Stream.size() < 300);
+        SkipList<int64_t, uint64_t> RestoredIntegerList;
+        Position = 0;
+        RestoredIntegerList.Deserialize(Source);
+        assert(RestoredIntegerList.GetSize() == 101);
+        assert(RestoredIntegerList.Search(numeric_limits<int64_t>::min())->second == numeric_limits<uint64_t>::max());
+        assert(RestoredIntegerList.Search(-50)->second == 0 && RestoredIntegerList.Search(49)->second == 99);
+
+        // Truncated and foreign streams are rejected...
+        for(const size_t Length : {size_t(0), size_t(3), Stream.size() / 2, Stream.size() - 1})
+        {
+            const string Whole = Stream;
+            Stream.resize(Length);
+            Position = 0;
+            [[maybe_unused]] bool Rejected = false;
+            try { RestoredIntegerList.Deserialize(Source); }
+            catch(const runtime_error &) { Rejected = true; }
+            assert(Rejected);
+            Stream = Whole;
+        }
+
+        // As are chunk lengths far beyond what the stream holds, without
+        //  allocating for them...
+        for(const char *Length : {"\xFF\xFF\xFF\xFF\xFF\xFF\xFF\x7F", "\xFF\xFF\xFF\xFF\x0F"})
+        {
+            const string Whole = Stream;
+            Stream.replace(5, 1, Length);
+            Position = 0;
+            [[maybe_unused]] bool Rejected = false;
+            try { RestoredIntegerList.Deserialize(Source); }
+            catch(const runtime_error &) { Rejected = true; }
+            assert(Rejected);
+            Stream = Whole;
+        }
+
+        // A replica kept up to date with only the changes since each
+        //  checkpoint...
+        SkipList<int, int, less<int>, 16, SkipListPoolAllocator<16>, SkipListCheckpointTraits> PrimaryList;
+        SkipList<int, int> ReplicaList;
+        auto Checkpoint = [&]()
+        {
+            Stream.clear();
+            PrimaryList.SerializeChanges(Sink, 256);
+            Position = 0;
+            ReplicaList.Deserialize(Source);
+            assert(ReplicaList.GetSize() == PrimaryList.GetSize());
+            assert(equal(PrimaryList.begin(), PrimaryList.end(), ReplicaList.begin()));
+            return Stream.size();
+        };
+
+        // The first checkpoint carries everything, then each carries only
+        //  what changed, through every kind of modification...
+        const vector<pair<int, int>> Sorted = {{1, 1}, {3, 3}, {5, 5}};
+        PrimaryList.BulkLoad(Sorted.begin(), Sorted.end());
+        for(int Key = 10; Key < 10000; ++Key)
+            PrimaryList.Insert(Key, Key);
+        [[maybe_unused]] const size_t FullSize = Checkpoint();
+        assert(Checkpoint() < 16);
+        PrimaryList.Insert(5000, -1);
+        assert(Checkpoint() < 64);
+        PrimaryList.Delete(1);
+        PrimaryList.Delete(9999);
+        PrimaryList.Delete(4000);
+        PrimaryList.Insert(PrimaryList.Search(4001), 4001, -2);
+        PrimaryList.Insert(PrimaryList.Search(4001), 4002, -3);
+        PrimaryList.Insert(PrimaryList.end(), 20000, 20000);
+        assert(Checkpoint() < 128);
+        PrimaryList.Erase(PrimaryList.Search(100), PrimaryList.Search(200));
+        PrimaryList.TryEmplace(150, 150);
+        PrimaryList.Emplace(151, 151);
+        assert(Checkpoint() < 128);
+
+        // Random batches...
+        for(int Batch = 0; Batch < 20; ++Batch)
+        {
+            for(int Operation = 0; Operation < 50; ++Operation)
+            {
+                const int Key = static_cast<int>(RandomGenerator() % 12000);
+                if(RandomGenerator() % 3)
+                    PrimaryList.Insert(Key, Batch);
+                else
+                    PrimaryList.Delete(Key);
+            }
+            assert(Checkpoint() < FullSize / 4);
+        }
+
+        // Clearing, then starting over...
+        PrimaryList.Clear();
+        Checkpoint();
+        PrimaryList.Insert(7, 7);
+        Checkpoint();
+        assert(ReplicaList.GetSize() == 1);
+
+        // If the sink throws, nothing is forgotten...
+        PrimaryList.Insert(8, 8);
+        [[maybe_unused]] bool Thrown = false;
+        try { PrimaryList.SerializeChanges([](const void *, size_t) { throw runtime_error("Sink failed"); }); }
+        catch(const runtime_error &) { Thrown = true; }
+        assert(Thrown);
+        Checkpoint();
+        assert(ReplicaList.Search(8)->second == 8);
+    }
+
+    // Check merging, splitting, and joining lists, and loading in parallel...
+    {
+        // Checks a list holds the given keys in order, at the right positions
+        //  going both ways, with the expected values...
+        using CompleteListType =
+            SkipList<int, string, less<int>, 16, SkipListPoolAllocator<16>, CompleteTraits>;
+        auto IsEqual = [](const auto &Left, const auto &Right)
+        {
+            return (Left.first == Right.first) && (Left.second == Right.second);
+        };
+        auto CheckList = [&IsEqual](const CompleteListType &List, const vector<pair<int, string>> &Expected)
+        {
+            assert(List.GetSize() == Expected.size());
+            assert(equal(List.begin(), List.end(), Expected.begin(), Expected.end(), IsEqual));
+            assert(equal(List.rbegin(), List.rend(), Expected.rbegin(), Expected.rend(), IsEqual));
+            for(size_t Index = 0; Index < Expected.size(); Index += 7)
+                assert(List.At(Index)->first == Expected[Index].first && List.Rank(Expected[Index].first) == Index);
+            assert(List.At(Expected.size()) == List.end());
+            List.MemoryUsage();
+        };
+
+        // Even keys merged with multiples of three, where the latter win...
+        CompleteListType EvenList, ThreeList;
+        vector<pair<int, string>> Expected;
+        for(int Key = 0; Key < 30000; ++Key)
+        {
+            if(Key % 2 == 0)
+                EvenList.Insert(Key, "Even");
+            if(Key % 3 == 0)
+                ThreeList.Insert(Key, "Three");
+            if((Key % 2 == 0) || (Key % 3 == 0))
+                Expected.emplace_back(Key, (Key % 3 == 0) ? "Three" : "Even");
+        }
+        EvenList.Merge(move(ThreeList));
+        CheckList(EvenList, Expected);
+        CheckList(ThreeList, {});
+        EvenList.Merge(move(EvenList));
+        EvenList.Merge(move(ThreeList));
+        CheckList(EvenList, Expected);
+
+        // The emptied list can be used again, and merged back into...
+        ThreeList.Insert(-1, "Negative");
+        ThreeList.Insert(1, "One");
+        ThreeList.Merge(move(EvenList));
+        Expected.insert(Expected.begin(), {-1, "Negative"});
+        Expected.insert(Expected.begin() + 2, {1, "One"});
+        CheckList(ThreeList, Expected);
+        ThreeList.Insert(2, "Two");
+        ThreeList.Delete(3);
+        Expected[3].second = "Two";
+        Expected.erase(Expected.begin() + 4);
+        CheckList(ThreeList, Expected);
+
+        // A replica following along through checkpoints sees only the merged
+        //  in keys...
+        string Stream;
+        auto Sink = [&](const void *Bytes, size_t Size)
+        {
+            Stream.append(static_cast<const char *>(Bytes), Size);
+        };
+        size_t Position = 0;
+        auto Source = [&](void *Bytes, size_t Size)
+        {
+            Size = min(Size, Stream.size() - Position);
+            Stream.copy(static_cast<char *>(Bytes), Size, Position);
+            Position += Size;
+            return Size;
+        };
+        SkipList<int, string> ReplicaList;
+        auto Checkpoint = [&]()
+        {
+            Stream.clear();
+            ThreeList.SerializeChanges(Sink);
+            Position = 0;
+            ReplicaList.Deserialize(Source);
+            assert(equal(ThreeList.begin(), ThreeList.end(), ReplicaList.begin(), ReplicaList.end()));
+            return Stream.size();
+        };
+        [[maybe_unused]] const size_t FullSize = Checkpoint();
+        CompleteListType TailList;
+        for(int Key = 0; Key < 100; ++Key)
+            TailList.Insert(Key * 1000 + 1, "Tail");
+        TailList.Insert(123456, "Tail");
+        ThreeList.Merge(move(TailList));
+        assert(Checkpoint() < FullSize / 4);
+
+        // Splitting off the upper half, and then everything or nothing...
+        Expected.assign(ThreeList.begin(), ThreeList.end());
+        const size_t SplitIndex = lower_bound(Expected.begin(), Expected.end(), make_pair(15000, string())) - Expected.begin();
+        CompleteListType UpperList = ThreeList.SplitAt(15000);
+        CheckList(ThreeList, vector<pair<int, string>>(Expected.begin(), Expected.begin() + SplitIndex));
+        CheckList(UpperList, vector<pair<int, string>>(Expected.begin() + SplitIndex, Expected.end()));
+        assert(Checkpoint() < FullSize / 4);
+        CompleteListType EmptyList = ThreeList.SplitAt(1000000);
+        CheckList(EmptyList, {});
+        CompleteListType WholeList = UpperList.SplitAt(-1000000);
+        CheckList(UpperList, {});
+        CheckList(WholeList, vector<pair<int, string>>(Expected.begin() + SplitIndex, Expected.end()));
+
+        // Both halves remain usable, and join back either way round, but not
+        //  while they overlap...
+        WholeList.Insert(15005, "Upper");
+        ThreeList.Insert(-2, "Lower");
+        Expected.emplace_back(15005, "Upper");
+        Expected.emplace_back(-2, "Lower");
+        sort(Expected.begin(), Expected.end());
+        [[maybe_unused]] bool Rejected = false;
+        ThreeList.Insert(20000, "Overlap");
+        try { WholeList.Join(move(ThreeList)); }
+        catch(const invalid_argument &) { Rejected = true; }
+        [[maybe_unused]] const size_t OverlapDeleted = ThreeList.Delete(20000);
+        assert(Rejected && OverlapDeleted == 1);
+        WholeList.Join(move(ThreeList));
+        CheckList(WholeList, Expected);
+        CheckList(ThreeList, {});
+        ThreeList.Join(move(WholeList));
+        ThreeList.Join(move(EmptyList));
+        CheckList(ThreeList, Expected);
+        Checkpoint();
+        CompleteListType RejoinedList = ThreeList.SplitAt(-1);
+        ThreeList.Join(move(RejoinedList));
+        Checkpoint();
+
+        // Releasing a whole pool's worth of nodes at once leaves those split
+        //  off it alone, and its chunks live on until both are gone...
+        auto IntegerList = make_unique<SkipList<int, int>>();
+        for(int Key = 0; Key < 50000; ++Key)
+            IntegerList->Insert(Key, Key);
+        SkipList<int, int> IntegerUpperList = IntegerList->SplitAt(10000);
+        IntegerList->Clear();
+        IntegerList.reset();
+        assert(IntegerUpperList.GetSize() == 40000 && IntegerUpperList.begin()->first == 10000);
+        IntegerUpperList.Insert(1, 1);
+        [[maybe_unused]] const size_t IntegerDeleted = IntegerUpperList.Delete(20000);
+        assert(IntegerDeleted == 1 && IntegerUpperList.GetSize() == 40000);
+        assert(IntegerUpperList.MemoryUsage().AllocatorSlack < 2 * 64 * 1024);
+
+        // Lists sharing a pool count each of its bytes only once...
+        SkipList<int, int> PoolList;
+        for(int Key = 0; Key < 1000; ++Key)
+            PoolList.Insert(Key, Key);
+        [[maybe_unused]] const size_t PoolSlack = PoolList.MemoryUsage().AllocatorSlack;
+        auto PoolUpperList = PoolList.SplitAt(990);
+        assert(PoolList.GetSize() == 990 && PoolUpperList.GetSize() == 10);
+        assert(PoolList.MemoryUsage().AllocatorSlack + PoolUpperList.MemoryUsage().AllocatorSlack == PoolSlack);
+        PoolList.Join(move(PoolUpperList));
+        assert(PoolList.GetSize() == 1000 && PoolList.MemoryUsage().AllocatorSlack == PoolSlack);
+
+        // As with the standard allocator...
+        SkipList<int, int, less<int>, 16, SkipListStandardAllocator<>> StandardList;
+        for(int Key = 0; Key < 1000; ++Key)
+            StandardList.Insert(Key, Key);
+        [[maybe_unused]] const size_t Slack = StandardList.MemoryUsage().AllocatorSlack;
+        auto StandardUpperList = StandardList.SplitAt(500);
+        assert(StandardList.GetSize() == 500 && StandardUpperList.GetSize() == 500);
+        assert(StandardList.MemoryUsage().AllocatorSlack + StandardUpperList.MemoryUsage().AllocatorSlack == Slack);
+        StandardList.Join(move(StandardUpperList));
+        assert(StandardList.GetSize() == 1000 && StandardList.MemoryUsage().AllocatorSlack == Slack);
+
+        // Appending straight after a split, before anything else touches the
+        //  lower half, must index from where it now ends, whichever levels
+        //  its towers reach...
+        using IndexedListType =
+            SkipList<int, int, less<int>, 16, SkipListPoolAllocator<16>, SkipListIndexableTraits>;
+        vector<pair<int, int>> Appended;
+        for(int Key = 100; Key < 140; ++Key)
+            Appended.emplace_back(Key, Key);
+        for(uint64_t Seed = 0; Seed < 64; ++Seed)
+        {
+            for(const bool Joining : {false, true})
+            {
+                IndexedListType LowerList(less<int>{}, SkipListPoolAllocator<16>{},
+                    SkipListLevelGenerator<>(Seed));
+                for(int Key = 0; Key < 40; ++Key)
+                    LowerList.Insert(Key, Key);
+                IndexedListType SplitList = LowerList.SplitAt(20);
+                if(Joining)
+                {
+                    IndexedListType AppendedList;
+                    AppendedList.BulkLoad(Appended.cbegin(), Appended.cend());
+                    LowerList.Join(move(AppendedList));
+                }
+                else
+                    LowerList.BulkLoad(Appended.cbegin(), Appended.cend());
+                assert(LowerList.GetSize() == 60 && SplitList.GetSize() == 20);
+                for(int Index = 0; Index < 60; ++Index)
+                {
+                    [[maybe_unused]] const int Key = (Index < 20) ? Index : (Index + 80);
+                    assert(LowerList.At(Index)->first == Key && LowerList.Rank(Key) == static_cast<size_t>(Index));
+                }
+                for(int Index = 0; Index < 20; ++Index)
+                    assert(SplitList.At(Index)->first == Index + 20 && SplitList.Rank(Index + 20) == static_cast<size_t>(Index));
+            }
+        }
+
+        // Sorted input with runs of equal keys loaded in parallel after what's
+        //  already there, including some equal to the last key, should match
+        //  loading it all at once...
+        vector<pair<int, string>> Sorted;
+        for(int Index = 0; Index < 200000; ++Index)
+            Sorted.emplace_back(Index / 3, to_string(Index));
+        for(const SkipListLevelAssignment Assignment :
+            {SkipListLevelAssignment::Random, SkipListLevelAssignment::Balanced})
+        {
+            CompleteListType SerialList, ParallelList;
+            SerialList.Insert(-5, "Before");
+            SerialList.Insert(0, "Before");
+            ParallelList.Insert(-5, "Before");
+            ParallelList.Insert(0, "Before");
+            SerialList.BulkLoad(Sorted.begin(), Sorted.end(), Assignment);
+            ParallelList.ParallelBulkLoad(Sorted.begin(), Sorted.end(), Assignment, 4);
+            Expected.assign(SerialList.begin(), SerialList.end());
+            assert(Expected.size() == 200000 / 3 + 2 && Expected[1].second == "2");
+            CheckList(ParallelList, Expected);
+        }
+
+        // The parallel load of balanced levels is exactly as balanced as it
+        //  would have been serially when there are no equal keys...
+        vector<pair<int, int>> Distinct;
+        for(int Key = 0; Key < 100000; ++Key)
+            Distinct.emplace_back(Key, Key);
+        SkipList<int, int, less<int>, 16, SkipListStandardAllocator<>, MeasuredTraits> BalancedList;
+        BalancedList.ParallelBulkLoad(Distinct.begin(), Distinct.end(), SkipListLevelAssignment::Balanced, 3);
+        const SkipListStatistics Statistics = BalancedList.GetStatistics();
+        for(size_t Level = 0; Level < Statistics.LevelHistogram.size() - 1; ++Level)
+            assert(Statistics.LevelHistogram[Level] == ((100000u >> Level) - (100000u >> (Level + 1))));
+        assert(BalancedList.At(54321)->first == 54321 && BalancedList.MemoryUsage().GetTotal() > 0);
+
+        // Lists seeded alike load the same random levels in parallel...
+        using SeededListType = SkipList<int, int, less<int>, 16, SkipListStandardAllocator<>, MeasuredTraits>;
+        SeededListType FirstSeededList(less<int>(), SkipListStandardAllocator<>(), SkipListLevelGenerator<>(7));
+        SeededListType SecondSeededList(less<int>(), SkipListStandardAllocator<>(), SkipListLevelGenerator<>(7));
+        FirstSeededList.ParallelBulkLoad(Distinct.begin(), Distinct.end(), SkipListLevelAssignment::Random, 3);
+        SecondSeededList.ParallelBulkLoad(Distinct.begin(), Distinct.end(), SkipListLevelAssignment::Random, 3);
+        assert(FirstSeededList.GetStatistics().LevelHistogram == SecondSeededList.GetStatistics().LevelHistogram);
+        SeededListType FirstSeededUpperList = FirstSeededList.SplitAt(50000);
+        SeededListType SecondSeededUpperList = SecondSeededList.SplitAt(50000);
+        for(int Key = 100000; Key < 101000; ++Key)
+        {
+            FirstSeededUpperList.Insert(Key, Key);
+            SecondSeededUpperList.Insert(Key, Key);
+        }
+        assert(FirstSeededUpperList.GetStatistics().LevelHistogram == SecondSeededUpperList.GetStatistics().LevelHistogram);
+    }
+
+    // Check inserting and deleting sorted batches...
+    {
+        // Lists with every feature a batch must keep up to date, and without,
+        //  checked against a map...
+        SkipList<int, string, less<int>, 16, SkipListPoolAllocator<16>, CompleteTraits> CompleteList;
+        SkipList<int, string> PlainList;
+        map<int, string> ExpectedMap;
+        auto CheckLists = [&]()
+        {
+            assert(CompleteList.GetSize() == ExpectedMap.size() && PlainList.GetSize() == ExpectedMap.size());
+            size_t Index = 0;
+            auto CompleteIterator = CompleteList.begin();
+            auto PlainIterator = PlainList.begin();
+            for([[maybe_unused]] const auto &KeyValue : ExpectedMap)
+            {
+                assert(CompleteIterator->first == KeyValue.first && CompleteIterator->second == KeyValue.second);
+                assert(PlainIterator->first == KeyValue.first && PlainIterator->second == KeyValue.second);
+                assert(CompleteList.At(Index)->first == KeyValue.first);
+                ++CompleteIterator, ++PlainIterator, ++Index;
+            }
+            assert(equal(ExpectedMap.rbegin(), ExpectedMap.rend(), CompleteList.rbegin(),
+                [](const auto &Left, const auto &Right) { return Left.first == Right.first; }));
+        };
+
+        // A replica following along through checkpoints...
+        string Stream;
+        SkipList<int, string> ReplicaList;
+        auto Checkpoint = [&]()
+        {
+            Stream.clear();
+            CompleteList.SerializeChanges([&](const void *Bytes, size_t Size)
+            {
+                Stream.append(static_cast<const char *>(Bytes), Size);
+            });
+            size_t Position = 0;
+            ReplicaList.Deserialize([&](void *Bytes, size_t Size)
+            {
+                Size = min(Size, Stream.size() - Position);
+                Stream.copy(static_cast<char *>(Bytes), Size, Position);
+                Position += Size;
+                return Size;
+            });
+            assert(equal(CompleteList.begin(), CompleteList.end(), ReplicaList.begin(), ReplicaList.end()));
+        };
+
+        // Random sorted batches of insertions, with runs of equal keys, and
+        //  of deletions, with some keys missing...
+        for(int Batch = 0; Batch < 30; ++Batch)
+        {
+            vector<pair<int, string>> Insertions;
+            for(int Count = 0; Count < 500; ++Count)
+            {
+                const int Key = static_cast<int>(RandomGenerator() % 5000);
+                Insertions.emplace_back(Key, to_string(Batch * 10000 + Count));
+            }
+            stable_sort(Insertions.begin(), Insertions.end(),
+                [](const auto &Left, const auto &Right) { return Left.first < Right.first; });
+            for(const auto &KeyValue : Insertions)
+                ExpectedMap[KeyValue.first] = KeyValue.second;
+            CompleteList.InsertBatch(Insertions.begin(), Insertions.end());
+            PlainList.InsertBatch(Insertions.begin(), Insertions.end());
+            CheckLists();
+            Checkpoint();
+
+            vector<int> Deletions;
+            for(int Count = 0; Count < 300; ++Count)
+                Deletions.push_back(static_cast<int>(RandomGenerator() % 5000));
+            sort(Deletions.begin(), Deletions.end());
+            size_t Expected = 0;
+            for(const int Key : Deletions)
+                Expected += ExpectedMap.erase(Key);
+            [[maybe_unused]] const size_t CompleteDeleted = CompleteList.DeleteBatch(Deletions.begin(), Deletions.end());
+            [[maybe_unused]] const size_t PlainDeleted = PlainList.DeleteBatch(Deletions.begin(), Deletions.end());
+            assert(CompleteDeleted == Expected && PlainDeleted == Expected);
+            CheckLists();
+            Checkpoint();
+        }
+
+        // Deleting everything, then inserting again, and empty batches...
+        vector<int> Everything;
+        for(const auto &KeyValue : ExpectedMap)
+            Everything.push_back(KeyValue.first);
+        [[maybe_unused]] const size_t EverythingDeleted = CompleteList.DeleteBatch(Everything.begin(), Everything.end());
+        assert(EverythingDeleted == ExpectedMap.size());
+        PlainList.DeleteBatch(Everything.begin(), Everything.end());
+        ExpectedMap.clear();
+        CheckLists();
+        [[maybe_unused]] const size_t NothingDeleted = CompleteList.DeleteBatch(Everything.begin(), Everything.begin());
+        assert(NothingDeleted == 0);
+        const vector<pair<int, string>> Tail = {{1, "One"}, {2, "Two"}, {3, "Three"}};
+        CompleteList.InsertBatch(Tail.begin(), Tail.end());
+        PlainList.InsertBatch(Tail.begin(), Tail.end());
+        ExpectedMap.insert(Tail.begin(), Tail.end());
+        CheckLists();
+    }
+
+    // Check the highest level stays exact through every way of removing
+    //  nodes...
+    {
+        // Checks a list's highest level is that of its tallest node...
+        using MeasuredListType = SkipList<int, int, less<int>, 16, SkipListPoolAllocator<16>, MeasuredTraits>;
+        auto CheckHeight = [](const MeasuredListType &List)
+        {
+            const SkipListStatistics Statistics = List.GetStatistics();
+            [[maybe_unused]] int Tallest = 0;
+            for(int Level = 0; Level < static_cast<int>(Statistics.LevelHistogram.size()); ++Level)
+            {
+                if(Statistics.LevelHistogram[Level])
+                    Tallest = Level;
+            }
+            assert(Statistics.HighestLevel == Tallest);
+        };
+
+        // A perfectly balanced list's tallest nodes are at known positions...
+        vector<pair<int, int>> Sorted;
+        for(int Key = 0; Key < 65536; ++Key)
+            Sorted.emplace_back(Key, Key);
+        MeasuredListType List(SkipListFromSortedRange, Sorted.begin(), Sorted.end(), SkipListLevelAssignment::Balanced);
+        assert(List.GetStatistics().HighestLevel == 15);
+
+        // Deleting them one at a time, in batches, and by range...
+        [[maybe_unused]] const size_t TallestDeleted = List.Delete(65535);
+        [[maybe_unused]] const size_t TallerDeleted = List.Delete(32767);
+        assert(TallestDeleted == 1 && TallerDeleted == 1);
+        CheckHeight(List);
+        assert(List.GetStatistics().HighestLevel == 14);
+        const vector<int> Batch = {16383, 49151};
+        [[maybe_unused]] const size_t BatchDeleted = List.DeleteBatch(Batch.begin(), Batch.end());
+        assert(BatchDeleted == 2);
+        CheckHeight(List);
+        assert(List.GetStatistics().HighestLevel == 13);
+        [[maybe_unused]] const size_t Size = List.GetSize();
+        [[maybe_unused]] const size_t RangeErased = List.Erase(List.Search(4000), List.end());
+        assert(RangeErased == Size - 4000);
+        CheckHeight(List);
+        assert(List.GetStatistics().HighestLevel == 11);
+
+        // Splitting off the tallest nodes, leaving both parts exact...
+        MeasuredListType Upper = List.SplitAt(2047);
+        CheckHeight(List);
+        CheckHeight(Upper);
+        assert(List.GetStatistics().HighestLevel == 10 && Upper.GetStatistics().HighestLevel == 11);
+
+        // Merging in a list holding the keys of our tallest nodes releases
+        //  ours, which leaves only the lower levels of ours...
+        MeasuredListType Replacements;
+        Replacements.Insert(1023, 0);
+        Replacements.Insert(2046, 0);
+        List.Merge(move(Replacements));
+        CheckHeight(List);
+        Upper.Join(move(List));
+        CheckHeight(Upper);
+
+        // Deleting all but a few...
+        MeasuredListType Shrunk(SkipListFromSortedRange, Sorted.begin(), Sorted.end());
+        vector<int> AllButFew;
+        for(int Key = 0; Key < 65536; ++Key)
+        {
+            if(Key % 4096)
+                AllButFew.push_back(Key);
+        }
+        Shrunk.DeleteBatch(AllButFew.begin(), AllButFew.end());
+        CheckHeight(Shrunk);
+        assert(Shrunk.GetSize() == 16);
+
+        // Popping and extracting from the front...
+        [[maybe_unused]] const bool Popped = Shrunk.PopFront();
+        assert(Popped);
+        CheckHeight(Shrunk);
+        [[maybe_unused]] const size_t Extracted =
+            Shrunk.ExtractWhile([](const pair<const int, int> &KeyValue) { return KeyValue.first < 40000; });
+        assert(Extracted == 9);
+        CheckHeight(Shrunk);
+        assert(Shrunk.GetSize() == 6);
+        Shrunk.Clear();
+        CheckHeight(Shrunk);
+    }
+
+    // Check duplicate keys stay in insertion order through every way of
+    //  adding and removing them...
+    cout << "Duplicate keys..." << endl;
+    {
+        // Checks a list holds the same pairs in the same order as a multimap,
+        //  at the right positions going both ways...
+        using MultimapListType =
+            SkipList<int, int, less<int>, 16, SkipListPoolAllocator<16>, IndexableMultimapTraits>;
+        auto CheckList = [](const MultimapListType &List, const multimap<int, int> &Expected)
+        {
+            assert(List.GetSize() == Expected.size());
+            assert(equal(List.begin(), List.end(), Expected.begin(), Expected.end()));
+            assert(equal(List.rbegin(), List.rend(), Expected.rbegin(), Expected.rend()));
+            size_t Index = 0;
+            for(auto Current = List.begin(); Current != List.end(); ++Current, ++Index)
+                assert(List.At(Index) == Current);
+        };
+
+        // Equal keys inserted every way keep their order. A multimap inserts
+        //  after equal keys too...
+        MultimapListType List;
+        multimap<int, int> Expected;
+        mt19937 Generator(7);
+        MultimapListType::iterator Hint = List.end();
+        for(int Sequence = 0; Sequence < 20000; ++Sequence)
+        {
+            const int Key = static_cast<int>(Generator() % 500);
+            switch(Sequence % 4)
+            {
+                case 0: List.Insert(Key, Sequence); break;
+                case 1:
+                {
+                    [[maybe_unused]] const bool Emplaced = List.Emplace(Key, Sequence).second;
+                    assert(Emplaced);
+                    break;
+                }
+                case 2:
+                {
+                    [[maybe_unused]] const bool Emplaced = List.TryEmplace(Key, Sequence).second;
+                    assert(Emplaced);
+                    break;
+                }
+                case 3: Hint = List.Insert(Hint, Key, Sequence); break;
+            }
+            Expected.emplace(Key, Sequence);
+        }
+        CheckList(List, Expected);
+
+        // Hinted at the pair it follows, or among its duplicates...
+        for(int Sequence = 0; Sequence < 2000; ++Sequence)
+        {
+            const int Key = static_cast<int>(Generator() % 500);
+            const auto [First, Last] = List.EqualRange(Key);
+            const auto Hint = ((Sequence % 2) && (First != Last)) ? prev(Last) : First;
+            [[maybe_unused]] const auto Inserted = List.Insert(Hint, Key, -Sequence);
+            assert(Inserted->second == -Sequence);
+            Expected.emplace(Key, -Sequence);
+        }
+        CheckList(List, Expected);
+
+        // Counting and finding ranges...
+        for(int Key = -1; Key <= 500; ++Key)
+        {
+            const auto [First, Last] = List.EqualRange(Key);
+            [[maybe_unused]] const auto [ExpectedFirst, ExpectedLast] = Expected.equal_range(Key);
+            assert(equal(First, Last, ExpectedFirst, ExpectedLast));
+            assert(List.Count(Key) == Expected.count(Key));
+            assert(First == List.LowerBound(Key) && Last == List.UpperBound(Key));
+            if(First != Last)
+                assert(List.Search(Key) == First);
+        }
+
+        // Deleting single pairs from among duplicates, by position...
+        for(int Deletion = 0; Deletion < 5000; ++Deletion)
+        {
+            const size_t Index = Generator() % List.GetSize();
+            [[maybe_unused]] auto Next = List.Delete(List.At(Index));
+            [[maybe_unused]] auto ExpectedNext = Expected.erase(next(Expected.begin(), static_cast<ptrdiff_t>(Index)));
+            assert((Next == List.end()) ? (ExpectedNext == Expected.end()) : (*Next == *ExpectedNext));
+        }
+        CheckList(List, Expected);
+
+        // Deleting by key removes every duplicate, singly and in batches...
+        for(int Key = 0; Key < 500; Key += 7)
+        {
+            [[maybe_unused]] const size_t KeyDeleted = List.Delete(Key);
+            [[maybe_unused]] const size_t KeyExpected = Expected.erase(Key);
+            assert(KeyDeleted == KeyExpected);
+        }
+        const vector<int> Batch = {1, 1, 2, 50, 51, 499, 600};
+        size_t Deleted = 0;
+        for(const int Key : Batch)
+            Deleted += Expected.erase(Key);
+        [[maybe_unused]] const size_t BatchDeleted = List.DeleteBatch(Batch.begin(), Batch.end());
+        assert(BatchDeleted == Deleted);
+        CheckList(List, Expected);
+
+        // Erasing a range beginning partway through some duplicates...
+        auto First = next(List.LowerBound(100));
+        auto ExpectedFirst = next(Expected.lower_bound(100));
+        [[maybe_unused]] const size_t RangeErased = List.Erase(First, List.LowerBound(200));
+        assert(RangeErased == static_cast<size_t>(distance(ExpectedFirst, Expected.lower_bound(200))));
+        Expected.erase(ExpectedFirst, Expected.lower_bound(200));
+        CheckList(List, Expected);
+
+        // Erasing a range ending partway through a run of duplicates must
+        //  leave the rest of the run linked on every level, whichever levels
+        //  the erased and surviving towers reach...
+        auto CheckEraseIntoRun = [](auto &&RunList)
+        {
+            for(int Sequence = 0; Sequence < 30; ++Sequence)
+                RunList.Insert(5, Sequence);
+            RunList.Insert(9, 30);
+            [[maybe_unused]] const size_t RunErased = RunList.Erase(RunList.begin(), next(RunList.begin(), 20));
+            assert(RunErased == 20);
+            assert(RunList.Search(5)->second == 20 && RunList.Count(5) == 10 && RunList.GetSize() == 11);
+            int Sequence = 20;
+            for([[maybe_unused]] const auto &[Key, Value] : RunList)
+            {
+                assert(Value == Sequence && Key == ((Value < 30) ? 5 : 9));
+              ++Sequence;
+            }
+            if constexpr(is_same_v<decay_t<decltype(RunList)>, MultimapListType>)
+                assert(RunList.At(10)->first == 9 && RunList.Rank(9) == 10 && RunList.At(3)->second == 23);
+            [[maybe_unused]] const size_t RunDeleted = RunList.Delete(5);
+            assert(RunDeleted == 10 && RunList.begin()->first == 9);
+        };
+        for(uint64_t Seed = 0; Seed < 64; ++Seed)
+        {
+            CheckEraseIntoRun(SkipList<int, int, less<int>, 16, SkipListPoolAllocator<16>, SkipListMultimapTraits>(
+                less<int>{}, SkipListPoolAllocator<16>{}, SkipListLevelGenerator<>(Seed)));
+            CheckEraseIntoRun(MultimapListType(less<int>{}, SkipListPoolAllocator<16>{}, SkipListLevelGenerator<>(Seed)));
+        }
+
+        // Sorted batches and bulk loads, including runs of equal keys, append
+        //  after those already present...
+        vector<pair<int, int>> Sorted;
+        for(int Index = 0; Index < 3000; ++Index)
+            Sorted.emplace_back(Index / 5, 100000 + Index);
+        List.InsertBatch(Sorted.begin(), Sorted.end());
+        Expected.insert(Sorted.begin(), Sorted.end());
+        CheckList(List, Expected);
+        MultimapListType Loaded(SkipListFromSortedRange, Sorted.begin(), Sorted.end());
+        Loaded.BulkLoad(Sorted.end() - 5, Sorted.end());
+        multimap<int, int> ExpectedLoaded(Sorted.begin(), Sorted.end());
+        ExpectedLoaded.insert(Sorted.end() - 5, Sorted.end());
+        CheckList(Loaded, ExpectedLoaded);
+
+        // Merging keeps both lists' duplicates, ours first...
+        List.Merge(move(Loaded));
+        for(const auto &KeyValue : ExpectedLoaded)
+            Expected.insert(KeyValue);
+        CheckList(List, Expected);
+        CheckList(Loaded, {});
+
+        // Without back pointers or positions, counting walks the range...
+        SkipList<int, int, less<int>, 16, SkipListPoolAllocator<16>, SkipListMultimapTraits> Plain;
+        for(int Sequence = 0; Sequence < 100; ++Sequence)
+            Plain.Insert(Sequence % 3, Sequence);
+        assert(Plain.Count(1) == 33 && Plain.Count(3) == 0);
+        [[maybe_unused]] const auto AfterDeleted = Plain.Delete(Plain.Search(1));
+        assert(AfterDeleted->second == 4 && Plain.Count(1) == 32);
+        [[maybe_unused]] const size_t OnesDeleted = Plain.Delete(1);
+        assert(OnesDeleted == 32 && Plain.GetSize() == 67);
+
+        // Lists without duplicates count at most one...
+        SkipList<int, int> Unique;
+        Unique.Insert(1, 1);
+        Unique.Insert(1, 2);
+        assert(Unique.Count(1) == 1 && Unique.Count(2) == 0);
+        [[maybe_unused]] const auto AfterUnique = Unique.Delete(Unique.begin());
+        assert(AfterUnique == Unique.end() && Unique.GetSize() == 0);
+    }
+
+    // Check updating values in place, and deleting pairs at iterators or
+    //  after inspecting them, against a map...
+    cout << "Updating in place and deleting after inspecting..." << endl;
+    {
+        // A list keeping checkpoints, so that a replica can follow along...
+        using CompleteListType =
+            SkipList<int, string, less<int>, 16, SkipListPoolAllocator<16>, CompleteTraits>;
+        CompleteListType CompleteList;
+        map<int, string> Expected;
+        string Stream;
+        SkipList<int, string> ReplicaList;
+        auto Checkpoint = [&]()
+        {
+            assert(equal(CompleteList.begin(), CompleteList.end(), Expected.begin(), Expected.end()));
+            Stream.clear();
+            CompleteList.SerializeChanges([&](const void *Bytes, size_t Size)
+            {
+                Stream.append(static_cast<const char *>(Bytes), Size);
+            });
+            size_t Position = 0;
+            ReplicaList.Deserialize([&](void *Bytes, size_t Size)
+            {
+                Size = min(Size, Stream.size() - Position);
+                Stream.copy(static_cast<char *>(Bytes), Size, Position);
+                Position += Size;
+                return Size;
+            });
+            assert(equal(CompleteList.begin(), CompleteList.end(), ReplicaList.begin(), ReplicaList.end()));
+        };
+
+        // Appending to each key's value, inserting those not yet present...
+        mt19937 Generator(11);
+        for(int Round = 0; Round < 4; ++Round)
+        {
+            for(int Update = 0; Update < 3000; ++Update)
+            {
+                const int Key = static_cast<int>(Generator() % 2000);
+                [[maybe_unused]] const bool Existed = Expected.count(Key);
+                [[maybe_unused]] const auto [Position, Inserted] =
+                    CompleteList.Upsert(Key, [&](string &Value) { Value += to_string(Round); });
+                Expected[Key] += to_string(Round);
+                assert(Inserted != Existed && Position->first == Key && Position->second == Expected[Key]);
+            }
+            Checkpoint();
+        }
+
+        // A throwing update leaves existing values as they were, and inserts
+        //  nothing...
+        [[maybe_unused]] const size_t Size = CompleteList.GetSize();
+        try { CompleteList.Upsert(-1, [](string &) { throw runtime_error("Update failed"); }); }
+        catch(const runtime_error &) {}
+        assert(CompleteList.GetSize() == Size && CompleteList.Search(-1) == CompleteList.end());
+
+        // Deleting only those whose values the predicate accepts...
+        size_t Deleted = 0;
+        for(int Key = -5; Key < 2005; ++Key)
+        {
+            const auto Found = Expected.find(Key);
+            const bool Accept = (Found != Expected.end()) && (Found->second.size() % 2 == 0);
+            [[maybe_unused]] const size_t KeyDeleted = CompleteList.DeleteIf(Key,
+                [&](const pair<const int, string> &KeyValue)
+                {
+                    assert(KeyValue.first == Key);
+                    return KeyValue.second.size() % 2 == 0;
+                });
+            assert(KeyDeleted == (Accept ? 1u : 0u));
+            if(Accept)
+            {
+                Expected.erase(Found);
+              ++Deleted;
+            }
+        }
+        assert(Deleted > 0);
+        Checkpoint();
+
+        // Erasing at iterators, then every other pair while walking...
+        [[maybe_unused]] const auto AfterErased = CompleteList.Erase(CompleteList.begin());
+        assert(AfterErased->first == next(Expected.begin())->first);
+        Expected.erase(Expected.begin());
+        for(auto Position = CompleteList.begin(); Position != CompleteList.end();)
+        {
+            Position = CompleteList.Erase(Position);
+            if(Position != CompleteList.end())
+                ++Position;
+        }
+        bool Odd = true;
+        for(auto Position = Expected.begin(); Position != Expected.end(); Odd = !Odd)
+            Position = Odd ? Expected.erase(Position) : next(Position);
+        Checkpoint();
+        for(size_t Index = 0; Index < Expected.size(); Index += 5)
+            assert(CompleteList.At(Index)->first == next(Expected.begin(), static_cast<ptrdiff_t>(Index))->first);
+
+        // With duplicates, the last pair with the key is updated, and the
+        //  predicate sees each in turn...
+        SkipList<int, int, less<int>, 16, SkipListPoolAllocator<16>, IndexableMultimapTraits> Multimap;
+        for(int Sequence = 0; Sequence < 10; ++Sequence)
+            Multimap.Insert(Sequence % 2, Sequence);
+        [[maybe_unused]] const bool OneInserted = Multimap.Upsert(1, [](int &Value) { Value = -Value; }).second;
+        assert(!OneInserted && Multimap.Last()->second == -9);
+        [[maybe_unused]] const bool TwoInserted =
+            Multimap.Upsert(2, [](int &Value) { assert(Value == 0); Value = 20; }).second;
+        assert(TwoInserted);
+        [[maybe_unused]] const size_t ZerosDeleted =
+            Multimap.DeleteIf(0, [](const pair<const int, int> &KeyValue) { return KeyValue.second % 4 == 0; });
+        assert(ZerosDeleted == 3);
+        vector<int> Values;
+        for(const auto &KeyValue : Multimap)
+            Values.push_back(KeyValue.second);
+        assert((Values == vector<int>{2, 6, 1, 3, 5, 7, -9, 20}));
+        assert(Multimap.At(3)->second == 3 && Multimap.Count(1) == 5);
+    }
+
+    // Check popping and extracting runs from the front, as an expiry queue
+    //  keyed by deadline does...
+    cout << "Popping and extracting from the front..." << endl;
+    {
+        // A list keeping checkpoints, so that a replica can follow along...
+        using CompleteListType =
+            SkipList<int, string, less<int>, 16, SkipListPoolAllocator<16>, CompleteTraits>;
+        CompleteListType CompleteList;
+        map<int, string> Expected;
+        string Stream;
+        SkipList<int, string> ReplicaList;
+        auto Checkpoint = [&]()
+        {
+            assert(CompleteList.GetSize() == Expected.size());
+            assert(equal(CompleteList.begin(), CompleteList.end(), Expected.begin(), Expected.end()));
+            assert(equal(CompleteList.rbegin(), CompleteList.rend(), Expected.rbegin(), Expected.rend()));
+            size_t Index = 0;
+            for(auto Current = Expected.begin(); Current != Expected.end(); ++Current, ++Index)
+            {
+                if(Index % 7 == 0)
+                    assert(CompleteList.At(Index)->first == Current->first && CompleteList.Rank(Current->first) == Index);
+            }
+            assert(CompleteList.Last() == (Expected.empty() ? CompleteList.end() : prev(CompleteList.end())));
+            Stream.clear();
+            CompleteList.SerializeChanges([&](const void *Bytes, size_t Size)
+            {
+                Stream.append(static_cast<const char *>(Bytes), Size);
+            });
+            size_t Position = 0;
+            ReplicaList.Deserialize([&](void *Bytes, size_t Size)
+            {
+                Size = min(Size, Stream.size() - Position);
+                Stream.copy(static_cast<char *>(Bytes), Size, Position);
+                Position += Size;
+                return Size;
+            });
+            assert(equal(CompleteList.begin(), CompleteList.end(), ReplicaList.begin(), ReplicaList.end()));
+        };
+
+        // Deadlines arriving out of order, expired in sweeps...
+        mt19937 Generator(13);
+        int Now = 0;
+        for(int Sweep = 0; Sweep < 50; ++Sweep)
+        {
+            for(int Arrival = 0; Arrival < 400; ++Arrival)
+            {
+                const int Deadline = Now + static_cast<int>(Generator() % 5000);
+                CompleteList.Insert(Deadline, to_string(Deadline));
+                Expected[Deadline] = to_string(Deadline);
+            }
+            Now += static_cast<int>(Generator() % 400);
+            vector<pair<int, string>> Expired;
+            CompleteList.ExtractWhile(
+                [&](const pair<const int, string> &KeyValue) { return KeyValue.first < Now; },
+                back_inserter(Expired));
+            const auto ExpectedEnd = Expected.lower_bound(Now);
+            assert(equal(Expected.begin(), ExpectedEnd, Expired.begin(), Expired.end(),
+                [](const auto &Left, const auto &Right)
+                { return (Left.first == Right.first) && (Left.second == Right.second); }));
+            Expected.erase(Expected.begin(), ExpectedEnd);
+            if(Sweep % 5 == 0)
+                Checkpoint();
+        }
+        Checkpoint();
+
+        // Popping single pairs...
+        for(int Pop = 0; Pop < 100; ++Pop)
+        {
+            [[maybe_unused]] const bool Popped = CompleteList.PopFront();
+            assert(Popped);
+            Expected.erase(Expected.begin());
+        }
+        Checkpoint();
+
+        // A throwing predicate removes nothing, while a throwing output still
+        //  removes the run...
+        [[maybe_unused]] const size_t Size = CompleteList.GetSize();
+        int Visited = 0;
+        try
+        {
+            CompleteList.ExtractWhile([&](const pair<const int, string> &)
+            {
+                if(++Visited == 10)
+                    throw runtime_error("Predicate failed");
+                return true;
+            });
+        }
+        catch(const runtime_error &) {}
+        assert(CompleteList.GetSize() == Size);
+        int Output = 0;
+        auto ThrowingOutput = [&](const pair<const int, string> &)
+        {
+            if(++Output == 3)
+                throw runtime_error("Output failed");
+        };
+        struct ThrowingIteratorType
+        {
+            decltype(ThrowingOutput) *m_Output;
+            ThrowingIteratorType &operator*() { return *this; }
+            ThrowingIteratorType &operator++() { return *this; }
+            ThrowingIteratorType &operator=(const pair<const int, string> &KeyValue)
+            {
+                (*m_Output)(KeyValue);
+                return *this;
+            }
+        };
+        const int Until = next(Expected.begin(), 5)->first;
+        try
+        {
+            CompleteList.ExtractWhile(
+                [&](const pair<const int, string> &KeyValue) { return KeyValue.first < Until; },
+                ThrowingIteratorType{&ThrowingOutput});
+        }
+        catch(const runtime_error &) {}
+        Expected.erase(Expected.begin(), Expected.lower_bound(Until));
+        Checkpoint();
+
+        // Extracting everything, then popping an empty list, which can be
+        //  refilled...
+        [[maybe_unused]] const size_t AllExtracted =
+            CompleteList.ExtractWhile([](const pair<const int, string> &) { return true; });
+        assert(AllExtracted == Expected.size());
+        Expected.clear();
+        [[maybe_unused]] const bool EmptyPopped = CompleteList.PopFront();
+        [[maybe_unused]] const size_t NoneExtracted = CompleteList.ExtractWhile([](const auto &) { return true; });
+        assert(!EmptyPopped && NoneExtracted == 0);
+        Checkpoint();
+        for(int Key = 0; Key < 1000; ++Key)
+        {
+            CompleteList.Insert(Key, "");
+            Expected[Key] = "";
+        }
+        Checkpoint();
+
+        // Among duplicates, those to the front go first...
+        SkipList<int, int, less<int>, 16, SkipListPoolAllocator<16>, IndexableMultimapTraits> Multimap;
+        for(int Sequence = 0; Sequence < 10; ++Sequence)
+            Multimap.Insert(Sequence % 3, Sequence);
+        vector<pair<int, int>> Extracted;
+        Multimap.ExtractWhile([](const pair<const int, int> &KeyValue) { return KeyValue.second != 4; },
+            back_inserter(Extracted));
+        assert((Extracted == vector<pair<int, int>>{{0, 0}, {0, 3}, {0, 6}, {0, 9}, {1, 1}}));
+        [[maybe_unused]] const bool MultimapPopped = Multimap.PopFront();
+        assert(MultimapPopped && Multimap.begin()->second == 7 && Multimap.At(0)->second == 7);
+        assert(Multimap.GetSize() == 4 && Multimap.Count(1) == 1);
+    }
+
+    cout << "Unrolled inserting, searching, and deleting..." << endl;
+    {
+        // Checks a list holds exactly the expected keys, in order, each with
+        //  its string representation as its value...
+        auto CheckKeys = [](const auto &UnrolledList, const vector<int> &Expected)
+        {
+            assert(UnrolledList.GetSize() == Expected.size());
+            auto ExpectedKey = cbegin(Expected);
+            for([[maybe_unused]] const auto &[Key, Value] : UnrolledList)
+            {
+                assert(Key == *ExpectedKey && Value == to_string(Key));
+              ++ExpectedKey;
+            }
+            assert(ExpectedKey == cend(Expected));
+        };
+
+        // Lists with the default blocks of many keys, and tiny blocks that
+        //  split and merge constantly...
+        UnrolledSkipList<int, string> UnrolledList;
+        UnrolledSkipList<int, string, less<int>, 16, 16> TinyList;
+        auto Check = [&](auto &List)
+        {
+            // Insert in random order, then update a few...
+            for(const int Key : RandomIntegers)
+                List.Insert(Key, to_string(Key));
+            List.Insert(42, "42");
+            vector<int> Expected(MaximumInteger);
+            iota(begin(Expected), end(Expected), 1);
+            CheckKeys(List, Expected);
+
+            // Search and bound present and absent keys...
+            assert(List.Search(5)->second == "5");
+            assert(List.Search(0) == List.end() && List.Search(MaximumInteger + 1) == List.end());
+            assert(List.LowerBound(0)->first == 1 && List.LowerBound(MaximumInteger + 1) == List.end());
+
+            // Visit a range, and stop early...
+            [[maybe_unused]] long Sum = 0;
+            assert(List.Range(100, 200, [&Sum](const auto &KeyValue) { Sum += KeyValue.first; }) == 100);
+            assert(Sum == 14950);
+            assert(List.Range(10, 1000, [](const auto &KeyValue) { return KeyValue.first < 19; }) == 10);
+            assert(List.Range(MaximumInteger - 5, MaximumInteger + 5, [](const auto &) {}) == 6);
+
+            // Delete every key that isn't a multiple of three, in random
+            //  order, so blocks empty and merge throughout...
+            for(const int Key : RandomIntegers)
+            {
+                if(Key % 3)
+                {
+                    [[maybe_unused]] const size_t Deleted = List.Delete(Key);
+                    assert(Deleted == 1);
+                }
+            }
+            [[maybe_unused]] const size_t FirstDeleted = List.Delete(1);
+            [[maybe_unused]] const size_t PastDeleted = List.Delete(MaximumInteger + 1);
+            assert(FirstDeleted == 0 && PastDeleted == 0);
+            Expected.erase(remove_if(begin(Expected), end(Expected),
+                [](const int Key) { return Key % 3; }), end(Expected));
+            CheckKeys(List, Expected);
+            assert(List.LowerBound(4)->first == 6);
+
+            // Values can be modified through an iterator...
+            List.Search(3)->second = "Three";
+            assert(List.Search(3)->second == "Three");
+            List.Search(3)->second = "3";
+
+            // Delete the rest, then reuse and clear...
+            for(const int Key : Expected)
+            {
+                [[maybe_unused]] const size_t Deleted = List.Delete(Key);
+                assert(Deleted == 1);
+            }
+            assert(List.GetSize() == 0 && List.begin() == List.end());
+            for(int Key = 1000; Key > 0; --Key)
+                List.Insert(Key, to_string(Key));
+            assert(List.GetSize() == 1000 && List.begin()->first == 1);
+            List.Clear();
+            assert(List.GetSize() == 0 && List.begin() == List.end());
+            List.Insert(7, "7");
+            CheckKeys(List, {7});
+        };
+        Check(UnrolledList);
+        Check(TinyList);
+
+        // Searching sorted arrays of each vectorised key type, including
+        //  unsigned keys with their top bit set, must agree with the standard
+        //  binary searches at every length and position...
+        auto CheckKeySearch = [](auto Type)
+        {
+            using KeyType = decltype(Type);
+            using KeySearchType [[maybe_unused]] = SkipListKeySearch<KeyType, less<KeyType>>;
+            const KeyType Base = is_floating_point_v<KeyType>
+                ? static_cast<KeyType>(-300) : (numeric_limits<KeyType>::max() / 2);
+            vector<KeyType> Keys;
+            for(int Index = 0; Index < 200; ++Index)
+                Keys.push_back(static_cast<KeyType>(Base + static_cast<KeyType>(Index * 3)));
+            for(size_t Count = 0; Count <= Keys.size(); Count += 7)
+            {
+                for(int Offset = -2; Offset < 605; ++Offset)
+                {
+                    [[maybe_unused]] const KeyType Key = static_cast<KeyType>(Base + static_cast<KeyType>(Offset));
+                    [[maybe_unused]] const auto First = Keys.data();
+                    assert(KeySearchType::template CountBefore<false>(First, Count, Key, less<KeyType>()) ==
+                           static_cast<size_t>(lower_bound(First, First + Count, Key) - First));
+                    assert(KeySearchType::template CountBefore<true>(First, Count, Key, less<KeyType>()) ==
+                           static_cast<size_t>(upper_bound(First, First + Count, Key) - First));
+                }
+            }
+        };
+        CheckKeySearch(int32_t());
+        CheckKeySearch(uint32_t());
+        CheckKeySearch(int64_t());
+        CheckKeySearch(uint64_t());
+        CheckKeySearch(float());
+        CheckKeySearch(double());
+        static_assert(!SkipListKeySearch<int, greater<int>>::Vectorised);
+
+        // Lists of unsigned keys spanning the top bit, so the express lane
+        //  is searched across it, and with a custom comparison object...
+        UnrolledSkipList<uint64_t, int> UnsignedList;
+        UnrolledSkipList<int, int, greater<int>> DescendingList;
+        for(const int Key : RandomIntegers)
+        {
+            UnsignedList.Insert((uint64_t(Key) << 45) ^ (uint64_t(1) << 63), Key);
+            DescendingList.Insert(Key, Key);
+        }
+        [[maybe_unused]] uint64_t PreviousKey = 0;
+        for(const auto &[Key, Value] : UnsignedList)
+        {
+            assert(Key > PreviousKey && UnsignedList.Search(Key)->second == Value);
+            PreviousKey = Key;
+        }
+        assert(DescendingList.begin()->first == MaximumInteger);
+        for(int Key = 1; Key <= MaximumInteger; Key += 2)
+        {
+            assert(DescendingList.Search(Key)->second == Key);
+            [[maybe_unused]] const size_t Deleted = DescendingList.Delete(Key + 1);
+            assert(Deleted == 1);
+        }
+        assert(DescendingList.GetSize() == MaximumInteger / 2);
+
+        // Blocks of small keys are packed by the bytes they fill...
+        static_assert(UnrolledSkipList<int, int>::BlockCapacity == 32);
+        static_assert(UnrolledSkipList<int, int, less<int>, 16, 16>::BlockCapacity == 4);
+    }
+
+    cout << "Adaptive inserting, searching, and deleting..." << endl;
+    {
+        // Checks a list holds exactly the expected keys, in order, each with
+        //  its string representation as its value...
+        auto CheckKeys = [](const auto &AdaptiveList, const vector<int> &Expected)
+        {
+            assert(AdaptiveList.GetSize() == Expected.size());
+            auto ExpectedKey = cbegin(Expected);
+            for([[maybe_unused]] const auto &[Key, Value] : AdaptiveList)
+            {
+                assert(Key == *ExpectedKey && Value == to_string(Key));
+              ++ExpectedKey;
+            }
+            assert(ExpectedKey == cend(Expected));
+        };
+
+        // Fill a list to its inline capacity in random order, and it must
+        //  behave the same before and after one more key promotes it...
+        AdaptiveSkipList<int, string, less<int>, 8> AdaptiveList;
+        map<int, string> Reference;
+        for(const int Key : {5, 1, 8, 3, 7, 2, 6, 4})
+        {
+            AdaptiveList.Insert(Key, to_string(Key));
+            Reference.emplace(Key, to_string(Key));
+        }
+        auto CheckAgainstReference = [&]()
+        {
+            assert(AdaptiveList.GetSize() == Reference.size());
+            assert(equal(AdaptiveList.begin(), AdaptiveList.end(), Reference.begin(), Reference.end(),
+                [](const auto &Left, const auto &Right)
+                    { return Left.first == Right.first && Left.second == Right.second; }));
+            for(int Key = 0; Key <= 11; ++Key)
+            {
+                [[maybe_unused]] const auto Found = Reference.find(Key);
+                assert((AdaptiveList.Search(Key) == AdaptiveList.end()) == (Found == Reference.end()));
+                [[maybe_unused]] const auto Bound = Reference.lower_bound(Key);
+                assert((AdaptiveList.LowerBound(Key) == AdaptiveList.end()) ?
+                    (Bound == Reference.end()) : (AdaptiveList.LowerBound(Key)->first == Bound->first));
+            }
+        };
+        for(const bool Promoted : {false, true})
+        {
+            // Update, delete from the middle and the ends, and reinsert...
+            assert(AdaptiveList.IsPromoted() == Promoted);
+            AdaptiveList.Insert(3, "Three");
+            assert(AdaptiveList.Search(3)->second == "Three" && AdaptiveList.GetSize() == Reference.size());
+            AdaptiveList.Search(3)->second = "3";
+            for(const auto &[Key, Count] : {pair{4, 1u}, pair{1, 1u}, pair{8, 1u}, pair{4, 0u}, pair{0, 0u}})
+            {
+                [[maybe_unused]] const size_t Deleted = AdaptiveList.Delete(Key);
+                assert(Deleted == Count);
+            }
+            Reference.erase(4);
+            Reference.erase(1);
+            Reference.erase(8);
+            CheckAgainstReference();
+            for(const int Key : {8, 1, 4})
+            {
+                AdaptiveList.Insert(Key, to_string(Key));
+                Reference.emplace(Key, to_string(Key));
+            }
+            CheckAgainstReference();
+            assert(AdaptiveList.IsPromoted() == Promoted);
+
+            // One key past capacity promotes it...
+            AdaptiveList.Insert(0, "0");
+            Reference.emplace(0, "0");
+            assert(AdaptiveList.IsPromoted());
+            CheckAgainstReference();
+            if(!Promoted)
+            {
+                [[maybe_unused]] const size_t Deleted = AdaptiveList.Delete(0);
+                assert(Deleted == 1);
+                Reference.erase(0);
+            }
+        }
+
+        // It stays promoted while shrinking, until cleared...
+        while(AdaptiveList.GetSize() > 1)
+            AdaptiveList.Delete(AdaptiveList.begin()->first);
+        assert(AdaptiveList.IsPromoted() && AdaptiveList.begin()->first == 8);
+        AdaptiveList.Clear();
+        assert(!AdaptiveList.IsPromoted() && AdaptiveList.GetSize() == 0 &&
+               AdaptiveList.begin() == AdaptiveList.end());
+        AdaptiveList.Insert(7, "7");
+        CheckKeys(AdaptiveList, {7});
+
+        // Many keys in random order, visiting ranges and deleting most, in a
+        //  list with the default capacity and one holding a single key...
+        AdaptiveSkipList<int, string> DefaultList;
+        AdaptiveSkipList<int, string, less<int>, 1> TinyList;
+        auto Check = [&](auto &List)
+        {
+            for(const int Key : RandomIntegers)
+                List.Insert(Key, to_string(Key));
+            vector<int> Expected(MaximumInteger);
+            iota(begin(Expected), end(Expected), 1);
+            CheckKeys(List, Expected);
+            [[maybe_unused]] long Sum = 0;
+            assert(List.Range(100, 200, [&Sum](const auto &KeyValue) { Sum += KeyValue.first; }) == 100);
+            assert(Sum == 14950);
+            assert(List.Range(10, 1000, [](const auto &KeyValue) { return KeyValue.first < 19; }) == 10);
+            for(const int Key : RandomIntegers)
+            {
+                if(Key % 3)
+                {
+                    [[maybe_unused]] const size_t Deleted = List.Delete(Key);
+                    assert(Deleted == 1);
+                }
+            }
+            Expected.erase(remove_if(begin(Expected), end(Expected),
+                [](const int Key) { return Key % 3; }), end(Expected));
+            CheckKeys(List, Expected);
+            List.Clear();
+            for(int Key = 3; Key > 0; --Key)
+                List.Insert(Key, to_string(Key));
+            CheckKeys(List, {1, 2, 3});
+        };
+        Check(DefaultList);
+        Check(TinyList);
+
+        // Keys searched with a custom comparison object, and keys that can
+        //  only be moved into the list when it's promoted...
+        AdaptiveSkipList<int, int, greater<int>, 4> DescendingList;
+        AdaptiveSkipList<int, unique_ptr<int>, less<int>, 4> MoveOnlyList;
+        for(int Key = 1; Key <= 6; ++Key)
+        {
+            DescendingList.Insert(Key, Key);
+            MoveOnlyList.Insert(Key, make_unique<int>(Key));
+        }
+        assert(DescendingList.begin()->first == 6 && DescendingList.LowerBound(3)->second == 3);
+        assert(MoveOnlyList.IsPromoted());
+        for([[maybe_unused]] const auto &[Key, Value] : MoveOnlyList)
+            assert(*Value == Key);
+    }
+
+    cout << "Concurrent inserting, searching, and deleting..." << endl;
+    {
+        // Every thread's record belongs to the one epoch domain, so no other
+        //  can be made...
+        static_assert(!is_default_constructible_v<SkipListEpochDomain>);
+
+        // Shared list and threads working on it at once...
+        ConcurrentSkipList<int, string> ConcurrentList;
+        const int ThreadCount = 4;
+        vector<thread> Threads;
+
+        // Each thread inserts every key, so most insertions find it already
+        //  present, then deletes the even keys it owns while searching the
+        //  odd ones...
+        for(int ThreadIndex = 0; ThreadIndex < ThreadCount; ++ThreadIndex)
+        {
+            Threads.emplace_back([&ConcurrentList, &RandomIntegers, ThreadIndex]
+            {
+                for(const int Key : RandomIntegers)
+                    ConcurrentList.Insert(Key, to_string(Key));
+                for(const int Key : RandomIntegers)
+                {
+                    if(Key % ThreadCount != ThreadIndex)
+                        continue;
+                    if(Key % 2 == 0)
+                    {
+                        [[maybe_unused]] const size_t Deleted = ConcurrentList.Delete(Key);
+                        assert(Deleted == 1);
+                    }
+                    else
+                        assert(ConcurrentList.Search(Key) == to_string(Key));
+                }
+            });
+        }
+        for(thread &Thread : Threads)
+            Thread.join();
+
+        // Only the odd keys should remain...
+        assert(ConcurrentList.GetSize() == MaximumInteger / 2);
+        assert(ConcurrentList.Contains(5) && !ConcurrentList.Contains(4));
+        [[maybe_unused]] const bool FiveInserted = ConcurrentList.Insert(5, "Five");
+        assert(!FiveInserted && *ConcurrentList.Search(5) == "5");
+        [[maybe_unused]] const size_t FourDeleted = ConcurrentList.Delete(4);
+        assert(FourDeleted == 0);
+
+        // Threads racing to delete the same keys should delete each once...
+        Threads.clear();
+        vector<int> Deleted(ThreadCount, 0);
+        for(int ThreadIndex = 0; ThreadIndex < ThreadCount; ++ThreadIndex)
+        {
+            Threads.emplace_back([&ConcurrentList, &Deleted, ThreadIndex]
+            {
+                for(int Key = 1; Key <= MaximumInteger; Key += 2)
+                    Deleted[ThreadIndex] += ConcurrentList.Delete(Key);
+            });
+        }
+        for(thread &Thread : Threads)
+            Thread.join();
+        long DeletedTotal = 0;
+        for(const int Count : Deleted)
+            DeletedTotal += Count;
+        assert(DeletedTotal == MaximumInteger / 2);
+        assert(ConcurrentList.GetSize() == 0);
+
+        // Threads inserting distinct keys that are emptied when moved from,
+        //  so a retried insertion must search with the key in its node...
+        ConcurrentSkipList<string, int> StringList;
+        const int StringsPerThread = 20000;
+        const int StringThreadCount = 8;
+        auto MakeString = [](const int Index) { return "Concurrent key " + to_string(Index); };
+        Threads.clear();
+        for(int ThreadIndex = 0; ThreadIndex < StringThreadCount; ++ThreadIndex)
+        {
+            Threads.emplace_back([&StringList, &MakeString, ThreadIndex]
+            {
+                for(int Index = 0; Index < StringsPerThread; ++Index)
+                {
+                    [[maybe_unused]] const bool Inserted =
+                        StringList.Insert(MakeString(Index * StringThreadCount + ThreadIndex), Index);
+                    assert(Inserted);
+                }
+            });
+        }
+        for(thread &Thread : Threads)
+            Thread.join();
+        assert(StringList.GetSize() == StringsPerThread * StringThreadCount);
+        for(int Index = 0; Index < StringsPerThread * StringThreadCount; ++Index)
+            assert(StringList.Contains(MakeString(Index)));
+    }
+
+    cout << "Lazy concurrent inserting, searching, and deleting..." << endl;
+    {
+        // Shared list with values too costly to copy into a lock-free node...
+        LazySkipList<int, vector<int>> LazyList;
+        const int ThreadCount = 4;
+        vector<thread> Threads;
+
+        // Each thread inserts every key, then deletes the even keys it owns
+        //  while visiting the odd ones in place...
+        for(int ThreadIndex = 0; ThreadIndex < ThreadCount; ++ThreadIndex)
+        {
+            Threads.emplace_back([&LazyList, &RandomIntegers, ThreadIndex]
+            {
+                for(const int Key : RandomIntegers)
+                    LazyList.Insert(Key, vector<int>(4, Key));
+                for(const int Key : RandomIntegers)
+                {
+                    if(Key % ThreadCount != ThreadIndex)
+                        continue;
+                    if(Key % 2 == 0)
+                    {
+                        [[maybe_unused]] const size_t Deleted = LazyList.Delete(Key);
+                        assert(Deleted == 1);
+                    }
+                    else
+                        assert(LazyList.Search(Key, [Key](const auto &KeyValue)
+                            { assert(KeyValue.second == vector<int>(4, Key)); }));
+                }
+            });
+        }
+        for(thread &Thread : Threads)
+            Thread.join();
+
+        // Only the odd keys should remain...
+        assert(LazyList.GetSize() == MaximumInteger / 2);
+        assert(LazyList.Contains(5) && !LazyList.Contains(4));
+        [[maybe_unused]] const bool FiveInserted = LazyList.Insert(5, vector<int>{});
+        assert(!FiveInserted);
+        assert(LazyList.Search(5)->size() == 4);
+        assert(!LazyList.Search(4));
+
+        // Threads racing to delete the same keys should delete each once...
+        Threads.clear();
+        vector<int> Deleted(ThreadCount, 0);
+        for(int ThreadIndex = 0; ThreadIndex < ThreadCount; ++ThreadIndex)
+        {
+            Threads.emplace_back([&LazyList, &Deleted, ThreadIndex]
+            {
+                for(int Key = 1; Key <= MaximumInteger; Key += 2)
+                    Deleted[ThreadIndex] += LazyList.Delete(Key);
+            });
+        }
+        for(thread &Thread : Threads)
+            Thread.join();
+        long DeletedTotal = 0;
+        for(const int Count : Deleted)
+            DeletedTotal += Count;
+        assert(DeletedTotal == MaximumInteger / 2);
+        assert(LazyList.GetSize() == 0);
+    }
+
     return 0;
 }
 
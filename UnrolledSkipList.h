@@ -0,0 +1,1264 @@
+/*
+    Copyright (C) 2024-2025 Cartesian Theatre. All rights reserved.
+*/
+
+// Multiple include protection...
+#ifndef _UNROLLED_SKIP_LIST_H_
+#define _UNROLLED_SKIP_LIST_H_
+
+// Includes...
+
+    // Standard C++ / POSIX system headers...
+    #include <algorithm>
+    #include <array>
+    #include <cassert>
+    #include <cstddef>
+    #include <cstdint>
+    #include <functional>
+    #include <iterator>
+    #include <limits>
+    #include <memory>
+    #include <new>
+    #include <type_traits>
+    #include <utility>
+    #include <vector>
+
+    // Our headers...
+    #include "SkipList.h"
+
+    // Vector instructions for searching keys, unless disabled...
+    #if !defined(SKIP_LIST_NO_SIMD) && defined(__AVX2__)
+        #include <immintrin.h>
+        #define SKIP_LIST_SIMD_AVX2 1
+    #elif !defined(SKIP_LIST_NO_SIMD) && defined(__ARM_NEON) && defined(__aarch64__)
+        #include <arm_neon.h>
+        #define SKIP_LIST_SIMD_NEON 1
+    #endif
+
+// Vectorised comparison of a run of keys against a single key. Each
+//  specialisation for a key type the instruction set can compare provides the
+//  number of keys compared at once, and counts how many of that many keys
+//  are less than the given key, or not greater than it if Inclusive...
+//
+//      static constexpr std::size_t Lanes;
+//      template <bool Inclusive>
+//      static std::size_t CountBefore(const KeyType *Keys, KeyType Key) noexcept;
+//
+//  Key types without a specialisation are searched with scalar comparisons...
+template <typename KeyType, typename = void>
+class SkipListSimdKeys
+{
+    // Public constants...
+    public:
+
+        // Not vectorised...
+        static constexpr std::size_t Lanes = 0;
+};
+
+#if defined(SKIP_LIST_SIMD_AVX2)
+
+// 32 and 64-bit integers compared eight or four at a time. AVX2 only
+//  compares signed integers, so unsigned ones have their sign bit flipped
+//  first...
+template <typename KeyType>
+class SkipListSimdKeys<KeyType, std::enable_if_t<
+    std::is_integral_v<KeyType> && ((sizeof(KeyType) == 4) || (sizeof(KeyType) == 8))>>
+{
+    // Public constants...
+    public:
+
+        // Keys compared at once...
+        static constexpr std::size_t Lanes = 32 / sizeof(KeyType);
+
+    // Public methods...
+    public:
+
+        // Count how many of the run of keys are before the given key...
+        template <bool Inclusive>
+        static std::size_t CountBefore(const KeyType * const Keys, const KeyType Key) noexcept
+        {
+            // Load the keys and broadcast the one to compare with, flipping
+            //  the sign bits of unsigned ones...
+            __m256i Run = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(Keys));
+            __m256i Broadcast = (sizeof(KeyType) == 4)
+                ? _mm256_set1_epi32(static_cast<int>(Key))
+                : _mm256_set1_epi64x(static_cast<long long>(Key));
+            if constexpr(std::is_unsigned_v<KeyType>)
+            {
+                const __m256i SignBits = (sizeof(KeyType) == 4)
+                    ? _mm256_set1_epi32(std::numeric_limits<int>::min())
+                    : _mm256_set1_epi64x(std::numeric_limits<long long>::min());
+                Run = _mm256_xor_si256(Run, SignBits);
+                Broadcast = _mm256_xor_si256(Broadcast, SignBits);
+            }
+
+            // Keys less than the key are those it's greater than. Keys not
+            //  greater than it are all but those greater...
+            const __m256i Greater = Inclusive
+                ? CompareGreater(Run, Broadcast)
+                : CompareGreater(Broadcast, Run);
+            const int Count = __builtin_popcount(GetMask(Greater));
+            return Inclusive ? (Lanes - Count) : static_cast<std::size_t>(Count);
+        }
+
+    // Protected methods...
+    protected:
+
+        // Compare each lane for signed greater than...
+        static __m256i CompareGreater(const __m256i Left, const __m256i Right) noexcept
+        {
+            if constexpr(sizeof(KeyType) == 4)
+                return _mm256_cmpgt_epi32(Left, Right);
+            else
+                return _mm256_cmpgt_epi64(Left, Right);
+        }
+
+        // Gather a bit from each lane of the given comparison...
+        static unsigned GetMask(const __m256i Comparison) noexcept
+        {
+            if constexpr(sizeof(KeyType) == 4)
+                return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(Comparison)));
+            else
+                return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(Comparison)));
+        }
+};
+
+// Single and double precision floating point keys, compared eight or four at
+//  a time...
+template <typename KeyType>
+class SkipListSimdKeys<KeyType, std::enable_if_t<
+    std::is_same_v<KeyType, float> || std::is_same_v<KeyType, double>>>
+{
+    // Public constants...
+    public:
+
+        // Keys compared at once...
+        static constexpr std::size_t Lanes = 32 / sizeof(KeyType);
+
+    // Public methods...
+    public:
+
+        // Count how many of the run of keys are before the given key...
+        template <bool Inclusive>
+        static std::size_t CountBefore(const KeyType * const Keys, const KeyType Key) noexcept
+        {
+            constexpr int Predicate = Inclusive ? _CMP_LE_OQ : _CMP_LT_OQ;
+            if constexpr(std::is_same_v<KeyType, float>)
+                return __builtin_popcount(_mm256_movemask_ps(
+                    _mm256_cmp_ps(_mm256_loadu_ps(Keys), _mm256_set1_ps(Key), Predicate)));
+            else
+                return __builtin_popcount(_mm256_movemask_pd(
+                    _mm256_cmp_pd(_mm256_loadu_pd(Keys), _mm256_set1_pd(Key), Predicate)));
+        }
+};
+
+#elif defined(SKIP_LIST_SIMD_NEON)
+
+// 32 and 64-bit integers and floating point keys compared four or two at a
+//  time...
+template <typename KeyType>
+class SkipListSimdKeys<KeyType, std::enable_if_t<
+    std::is_arithmetic_v<KeyType> && !std::is_same_v<KeyType, bool> &&
+    ((sizeof(KeyType) == 4) || (sizeof(KeyType) == 8))>>
+{
+    // Public constants...
+    public:
+
+        // Keys compared at once...
+        static constexpr std::size_t Lanes = 16 / sizeof(KeyType);
+
+    // Public methods...
+    public:
+
+        // Count how many of the run of keys are before the given key. Each
+        //  lane of a comparison is all ones where true, so shifting each down
+        //  to a single bit and summing counts them...
+        template <bool Inclusive>
+        static std::size_t CountBefore(const KeyType * const Keys, const KeyType Key) noexcept
+        {
+            if constexpr(std::is_same_v<KeyType, float>)
+            {
+                const float32x4_t Run = vld1q_f32(Keys);
+                const float32x4_t Broadcast = vdupq_n_f32(Key);
+                return vaddvq_u32(vshrq_n_u32(
+                    Inclusive ? vcleq_f32(Run, Broadcast) : vcltq_f32(Run, Broadcast), 31));
+            }
+            else if constexpr(std::is_same_v<KeyType, double>)
+            {
+                const float64x2_t Run = vld1q_f64(Keys);
+                const float64x2_t Broadcast = vdupq_n_f64(Key);
+                return vaddvq_u64(vshrq_n_u64(
+                    Inclusive ? vcleq_f64(Run, Broadcast) : vcltq_f64(Run, Broadcast), 63));
+            }
+            else if constexpr((sizeof(KeyType) == 4) && std::is_signed_v<KeyType>)
+            {
+                const int32x4_t Run = vld1q_s32(reinterpret_cast<const std::int32_t *>(Keys));
+                const int32x4_t Broadcast = vdupq_n_s32(static_cast<std::int32_t>(Key));
+                return vaddvq_u32(vshrq_n_u32(
+                    Inclusive ? vcleq_s32(Run, Broadcast) : vcltq_s32(Run, Broadcast), 31));
+            }
+            else if constexpr(sizeof(KeyType) == 4)
+            {
+                const uint32x4_t Run = vld1q_u32(reinterpret_cast<const std::uint32_t *>(Keys));
+                const uint32x4_t Broadcast = vdupq_n_u32(static_cast<std::uint32_t>(Key));
+                return vaddvq_u32(vshrq_n_u32(
+                    Inclusive ? vcleq_u32(Run, Broadcast) : vcltq_u32(Run, Broadcast), 31));
+            }
+            else if constexpr(std::is_signed_v<KeyType>)
+            {
+                const int64x2_t Run = vld1q_s64(reinterpret_cast<const std::int64_t *>(Keys));
+                const int64x2_t Broadcast = vdupq_n_s64(static_cast<std::int64_t>(Key));
+                return vaddvq_u64(vshrq_n_u64(
+                    Inclusive ? vcleq_s64(Run, Broadcast) : vcltq_s64(Run, Broadcast), 63));
+            }
+            else
+            {
+                const uint64x2_t Run = vld1q_u64(reinterpret_cast<const std::uint64_t *>(Keys));
+                const uint64x2_t Broadcast = vdupq_n_u64(static_cast<std::uint64_t>(Key));
+                return vaddvq_u64(vshrq_n_u64(
+                    Inclusive ? vcleq_u64(Run, Broadcast) : vcltq_u64(Run, Broadcast), 63));
+            }
+        }
+};
+
+#endif
+
+// Search of a sorted array of keys for the position of a key, using the
+//  vectorised comparisons above where the key type has them and the default
+//  comparison object is used, since only then do they agree with it. Every
+//  other combination compares one key at a time...
+template <typename KeyType, typename LessThanComparisonType>
+class SkipListKeySearch
+{
+    // Public constants...
+    public:
+
+        // Whether searches are vectorised...
+        static constexpr bool Vectorised =
+            (SkipListSimdKeys<KeyType>::Lanes > 0) &&
+            (std::is_same_v<LessThanComparisonType, std::less<KeyType>> ||
+             std::is_same_v<LessThanComparisonType, std::less<>>);
+
+    // Public methods...
+    public:
+
+        // Count the keys in the given sorted array that are less than the
+        //  given key, or not greater than it if Inclusive, which is the index
+        //  of the first key after them...
+        template <bool Inclusive>
+        static std::size_t CountBefore(
+            const KeyType * const Keys,
+            const std::size_t Count,
+            const KeyType &Key,
+            const LessThanComparisonType &LessThanComparison)
+        {
+            // Whether the given key from the array is before the key...
+            auto IsBefore = [&](const KeyType &ArrayKey)
+            {
+                return Inclusive
+                    ? !LessThanComparison(Key, ArrayKey)
+                    : LessThanComparison(ArrayKey, Key);
+            };
+
+            // Without vector comparisons, binary search...
+            if constexpr(!Vectorised)
+                return static_cast<std::size_t>(
+                    std::partition_point(Keys, Keys + Count, IsBefore) - Keys);
+
+            // Otherwise narrow long arrays down by binary search first, then
+            //  compare a run of keys at a time. The keys are sorted, so the
+            //  first run that isn't entirely before the key holds the
+            //  position. Any keys left over are compared one at a time...
+            else
+            {
+                using SimdKeysType = SkipListSimdKeys<KeyType>;
+                constexpr std::size_t Window = SimdKeysType::Lanes * 4;
+
+                std::size_t Base = 0;
+                std::size_t Length = Count;
+                while(Length > Window)
+                {
+                    const std::size_t Half = Length / 2;
+                    Base = IsBefore(Keys[Base + Half]) ? (Base + Half) : Base;
+                    Length -= Half;
+                }
+
+                std::size_t Index = Base;
+                const std::size_t End = Base + Length;
+                for(; Index + SimdKeysType::Lanes <= End; Index += SimdKeysType::Lanes)
+                {
+                    const std::size_t Before =
+                        SimdKeysType::template CountBefore<Inclusive>(Keys + Index, Key);
+                    if(Before < SimdKeysType::Lanes)
+                        return Index + Before;
+                }
+                while(Index < End && IsBefore(Keys[Index]))
+                  ++Index;
+                return Index;
+            }
+        }
+};
+
+// Sorted arrays of keys alongside their values, the first given number of
+//  each constructed, in which keys and values are shifted to insert and
+//  erase them. Keys and values must be nothrow movable...
+template <typename KeyType, typename ValueType>
+class SkipListKeyValueArrays
+{
+    // Public methods...
+    public:
+
+        // Erase the key and value at the given index, shifting those after it
+        //  down. One fewer of each is then constructed...
+        static void EraseAt(
+            KeyType * const Keys,
+            ValueType * const Values,
+            const std::size_t Count,
+            const std::size_t Index) noexcept
+        {
+            assert(Index < Count);
+            std::move(Keys + Index + 1, Keys + Count, Keys + Index);
+            std::move(Values + Index + 1, Values + Count, Values + Index);
+            Keys[Count - 1].~KeyType();
+            Values[Count - 1].~ValueType();
+        }
+
+        // Insert the given key and value at the given index, shifting those
+        //  after it up. There must be room for one more of each, which is
+        //  then constructed...
+        static void InsertAt(
+            KeyType * const Keys,
+            ValueType * const Values,
+            const std::size_t Count,
+            const std::size_t Index,
+            KeyType &&Key,
+            ValueType &&Value) noexcept
+        {
+            assert(Index <= Count);
+
+            // Appending constructs in place...
+            if(Index == Count)
+            {
+                new(Keys + Index) KeyType(std::move(Key));
+                new(Values + Index) ValueType(std::move(Value));
+            }
+
+            // Otherwise move the last up into new storage and shift the rest
+            //  up after it to make room...
+            else
+            {
+                new(Keys + Count) KeyType(std::move(Keys[Count - 1]));
+                new(Values + Count) ValueType(std::move(Values[Count - 1]));
+                std::move_backward(Keys + Index, Keys + Count - 1, Keys + Count);
+                std::move_backward(Values + Index, Values + Count - 1, Values + Count);
+                Keys[Index] = std::move(Key);
+                Values[Index] = std::move(Value);
+            }
+        }
+};
+
+// Access operator's result for iterators whose dereference yields a pair of
+//  references to a key and its value rather than a reference to a pair. It
+//  holds the pair of references it points to...
+template <typename ReferenceType>
+class SkipListReferencePointer
+{
+    // Public methods...
+    public:
+
+        // Constructor...
+        explicit SkipListReferencePointer(const ReferenceType &Reference) noexcept
+          : m_Reference(Reference)
+        {
+        }
+
+        // Access the pair of references...
+        const ReferenceType *operator->() const noexcept { return &m_Reference; }
+
+    // Protected attributes...
+    protected:
+
+        // Pair of references pointed to...
+        ReferenceType   m_Reference;
+};
+
+// Call the given visitor with the given pair of references, returning whether
+//  visiting should continue. That's whatever the visitor returned if it
+//  returns a boolean, or always otherwise...
+template <typename VisitorType, typename ReferenceType>
+bool SkipListVisit(VisitorType &Visitor, const ReferenceType &KeyValue)
+{
+    if constexpr(std::is_convertible_v<
+        std::invoke_result_t<VisitorType &, const ReferenceType &>, bool>)
+        return static_cast<bool>(Visitor(KeyValue));
+    else
+    {
+        Visitor(KeyValue);
+        return true;
+    }
+}
+
+// Unrolled skip list holding many keys per node. Each node is a block with a
+//  small sorted array of keys, sized to fill the given number of bytes, and a
+//  separate array of their values, so that scanning the keys on the bottom
+//  level touches only the cache lines that hold keys. The levels above index
+//  the blocks by their first key. A block that fills up is split in half, and
+//  one that falls to a quarter full is merged with the block after it if
+//  they fit together. Keys and values must be nothrow movable, since inserting
+//  and deleting shift them within their block...
+template
+<
+    typename    KeyType,                                                        /* Key type */
+    typename    ValueType,                                                      /* Value type associated with key */
+    typename    LessThanComparisonType = decltype(std::less<KeyType>()),        /* How to compare keys to each other */
+    int         MaximumLevels = 16,                                             /* Maximum number of levels, each indexed from [0, MaximumLevel) */
+    std::size_t BlockBytes = 128,                                               /* Bytes of keys per block, such as one or two cache lines */
+    typename    AllocatorType = SkipListPoolAllocator<MaximumLevels>,           /* Block allocator */
+    typename    LevelGeneratorType = SkipListLevelGenerator<>                   /* How new blocks' levels are chosen */
+>
+class UnrolledSkipList
+{
+    // Check invariants...
+    static_assert(std::is_nothrow_move_constructible_v<KeyType> &&
+                  std::is_nothrow_move_assignable_v<KeyType> &&
+                  std::is_nothrow_move_constructible_v<ValueType> &&
+                  std::is_nothrow_move_assignable_v<ValueType>,
+                  "Keys and values must be nothrow movable to be shifted within blocks.");
+
+    // Protected forward declarations...
+    protected:
+
+        // Block type will be defined later...
+        class BlockType;
+
+    // Public constants...
+    public:
+
+        // Number of keys each block can hold, filling the requested bytes but
+        //  never fewer than four...
+        static constexpr std::size_t BlockCapacity =
+            std::max<std::size_t>(4, BlockBytes / sizeof(KeyType));
+
+    // Public types...
+    public:
+
+        // Keys and values are stored apart, so dereferencing an iterator
+        //  yields a pair of references to them rather than a reference to a
+        //  pair...
+        using ReferenceType     = std::pair<const KeyType &, ValueType &>;
+
+        // Type alias for how we count elements...
+        using size_type         = std::size_t;
+
+        // Custom iterator that iterates across each block's keys in turn...
+        class IteratorType
+        {
+            // Public traits...
+            public:
+
+                // Signed integer that can be used to identify distance
+                //  between iterators...
+                using difference_type   = std::ptrdiff_t;
+
+                // Category iterator belongs to...
+                using iterator_category = std::forward_iterator_tag;
+
+                // Type of object when iterator is dereferenced...
+                using value_type        = std::pair<KeyType, ValueType>;
+
+                // Type of reference to the type iterated over...
+                using reference         = ReferenceType;
+
+                // Access operator's result, which holds the pair of
+                //  references it points to...
+                using pointer           = SkipListReferencePointer<ReferenceType>;
+
+            // Public methods...
+            public:
+
+                // Default constructor...
+                IteratorType() noexcept
+                  : m_CurrentBlock(nullptr),
+                    m_Index(0)
+                {
+                }
+
+                // Construct pointing to the given key within the given block,
+                //  or the end if the block is null...
+                IteratorType(BlockType * const CurrentBlock, const size_type Index) noexcept
+                  : m_CurrentBlock(CurrentBlock),
+                    m_Index(Index)
+                {
+                    assert(!m_CurrentBlock || (m_Index < m_CurrentBlock->GetCount()));
+                }
+
+                // Dereference operator returns references to the current key
+                //  and its value. The key is const because the user modifying
+                //  it could change the sort order...
+                reference operator*() const noexcept
+                {
+                    return {m_CurrentBlock->GetKey(m_Index), m_CurrentBlock->GetValue(m_Index)};
+                }
+
+                // Access operator...
+                pointer operator->() const noexcept { return pointer(**this); }
+
+                // Prefix increment operator...
+                IteratorType &operator++() noexcept
+                {
+                    // Seek to the next key in this block, or the first in the
+                    //  next block once this one is exhausted...
+                    if(++m_Index == m_CurrentBlock->GetCount())
+                    {
+                        m_CurrentBlock = m_CurrentBlock->GetForwardPointer(0);
+                        m_Index = 0;
+                    }
+
+                    // Return reference to updated iterator...
+                    return *this;
+                }
+
+                // Postfix increment operator...
+                IteratorType operator++(int) noexcept
+                {
+                    // Return previous state, incrementing our self...
+                    return std::exchange(*this, ++IteratorType(*this));
+                }
+
+                // Inequality operator...
+                bool operator!=(const IteratorType &RightHandSide) const noexcept
+                {
+                    return !(*this == RightHandSide);
+                }
+
+                // Equality operator. The iterators are equal if they refer to
+                //  the same key in the same block...
+                bool operator==(const IteratorType &RightHandSide) const noexcept
+                {
+                    return (m_CurrentBlock == RightHandSide.m_CurrentBlock) &&
+                           (m_Index == RightHandSide.m_Index);
+                }
+
+            // Protected attributes...
+            protected:
+
+                // The list may examine the block an iterator refers to...
+                friend class UnrolledSkipList;
+
+                // Current block, or null at the end...
+                BlockType  *m_CurrentBlock;
+
+                // Index of the current key within the block...
+                size_type   m_Index;
+        };
+
+        // Type alias for iterator...
+        using iterator          = IteratorType;
+
+        // Type alias for const iterator...
+        using const_iterator    = iterator;
+
+    // Public methods...
+    public:
+
+        // Constructor. Pass a level generator with a fixed seed for
+        //  deterministic behaviour during debugging...
+        explicit UnrolledSkipList(
+            const LessThanComparisonType &LessThanCompare = LessThanComparisonType(),
+            AllocatorType Allocator = AllocatorType(),
+            LevelGeneratorType LevelGenerator = LevelGeneratorType())
+          : m_Header(nullptr),
+            m_HighestLevel(0),
+            m_LessThanComparison(LessThanCompare),
+            m_LevelGenerator(std::move(LevelGenerator)),
+            m_Size(0),
+            m_Allocator(std::move(Allocator))
+        {
+            // Allocate the header block with a tower as tall as the list could
+            //  ever grow. It never holds any keys...
+            m_Header = CreateSentinelBlock(MaximumLevels);
+        }
+
+        // Blocks are owned by exactly one list...
+        UnrolledSkipList(const UnrolledSkipList &) = delete;
+        UnrolledSkipList &operator=(const UnrolledSkipList &) = delete;
+
+        // Retrieve an iterator start...
+        iterator begin() const noexcept { return iterator(m_Header->GetForwardPointer(0), 0); }
+        const_iterator cbegin() const noexcept { return begin(); }
+
+        // Retrieve an iterator end...
+        iterator end() const noexcept { return iterator(); }
+        const_iterator cend() const noexcept { return end(); }
+
+        // Clear all elements...
+        void Clear() noexcept
+        {
+            // Release every block after the header...
+            DestroyBlocks();
+
+            // Update the header's forward pointers to mark the end of the
+            //  list...
+            for(int CurrentLevel = 0; CurrentLevel < MaximumLevels; ++CurrentLevel)
+                m_Header->SetForwardPointer(CurrentLevel, nullptr);
+
+            // Nothing remains in the express lane...
+            m_ExpressKeys.clear();
+            m_ExpressBlocks.clear();
+
+            // Reset the highest level and the element count...
+            m_HighestLevel = 0;
+            m_Size = 0;
+        }
+
+        // Delete the given key and its associated value if the key exists.
+        //  Return number of deleted elements, which should be either zero or
+        //  one...
+        size_type Delete(const KeyType &Key) noexcept
+        {
+            // Find the block that would hold the key...
+            BlockType * const Block = SeekBlock(Key);
+
+            // The key is less than every other, so it doesn't exist...
+            if(Block == m_Header)
+                return 0;
+
+            // Nor does it if the block doesn't have it...
+            const size_type Index = FindIndex(Block, Key);
+            if(Index == Block->GetCount() || IsLessThan(Key, Block->GetKey(Index)))
+                return 0;
+
+            // If the block holds only this key, the blocks on its left on each
+            //  level are those before the key, so unlink and release it...
+            typename BlockType::ForwardPointersType UpdatedPointers;
+            if(Block->GetCount() == 1)
+            {
+                SeekBlock<false>(Key, &UpdatedPointers);
+                UnlinkBlock(UpdatedPointers, Block);
+                DestroyBlock(Block);
+            }
+
+            // Otherwise remove it from its block...
+            else
+            {
+                // If it was the block's first, the express lane must know...
+                Block->EraseAt(Index);
+                if(Index == 0)
+                    UpdateExpressKey(Block, Key);
+
+                // If it has fallen to a quarter full, merge the next block
+                //  into it if they fit together without being nearly full, so
+                //  that the merged block doesn't just split again...
+                BlockType * const NextBlock = Block->GetForwardPointer(0);
+                if(NextBlock &&
+                   (Block->GetCount() <= BlockCapacity / 4) &&
+                   (Block->GetCount() + NextBlock->GetCount() <= (BlockCapacity * 3) / 4))
+                {
+                    SeekBlock<false>(NextBlock->GetKey(0), &UpdatedPointers);
+                    UnlinkBlock(UpdatedPointers, NextBlock);
+                    NextBlock->MoveTail(0, *Block);
+                    DestroyBlock(NextBlock);
+                }
+            }
+          --m_Size;
+
+            // If we removed the block with the highest level, adjust the
+            //  list's highest level down to match the next highest...
+            while(m_HighestLevel > 0 && !m_Header->GetForwardPointer(m_HighestLevel))
+              --m_HighestLevel;
+
+            // Signal to user deletion of a single element...
+            return 1;
+        }
+
+        // Get the number of elements...
+        size_type GetSize() const noexcept { return m_Size; }
+
+        // Insert the given key and value if it does not exist, or update its
+        //  value if it does. Keys are shifted within their block to make room,
+        //  and a full block is split in half first...
+        void Insert(KeyType Key, ValueType Value)
+        {
+            // Find the block the key belongs in...
+            BlockType *Block = SeekBlock(Key);
+
+            // If the key is less than every other, it belongs at the start of
+            //  the first block...
+            if(Block == m_Header)
+            {
+                Block = m_Header->GetForwardPointer(0);
+
+                // If there are no blocks, start the first with the key and
+                //  link it in after the header on every level...
+                if(!Block)
+                {
+                    Block = CreateBlock(GetRandomLevel() + 1);
+                    Block->InsertAt(0, std::move(Key), std::move(Value));
+                    typename BlockType::ForwardPointersType UpdatedPointers;
+                    UpdatedPointers.fill(m_Header);
+                    LinkBlock(UpdatedPointers, Block);
+                  ++m_Size;
+                    return;
+                }
+            }
+
+            // This block has the given key, so update its value and we're
+            //  done...
+            size_type Index = FindIndex(Block, Key);
+            if(Index < Block->GetCount() && !IsLessThan(Key, Block->GetKey(Index)))
+            {
+                Block->GetValue(Index) = std::move(Value);
+                return;
+            }
+
+            // The block is full, so move its upper half into a new block after
+            //  it, and insert into whichever half the key belongs in...
+            if(Block->GetCount() == BlockCapacity)
+            {
+                // The new block's left on each level it participates in is the
+                //  block being split wherever that participates, including
+                //  when the key belongs before every other...
+                BlockType * const NewBlock = CreateBlock(GetRandomLevel() + 1);
+                typename BlockType::ForwardPointersType UpdatedPointers;
+                if(SeekBlock(Key, &UpdatedPointers) == m_Header)
+                    std::fill_n(UpdatedPointers.begin(), Block->GetLevel(), Block);
+
+                // Split...
+                const size_type Half = BlockCapacity / 2;
+                Block->MoveTail(Half, *NewBlock);
+                LinkBlock(UpdatedPointers, NewBlock);
+                if(Index > Half)
+                {
+                    Block = NewBlock;
+                    Index -= Half;
+                }
+            }
+
+            // Insert the key and value. If it's now its block's first, the
+            //  express lane must know...
+            Block->InsertAt(Index, std::move(Key), std::move(Value));
+            if(Index == 0)
+                UpdateExpressKey(Block, Block->GetKey(1));
+          ++m_Size;
+        }
+
+        // Find the first key value pair whose key is not less than the given
+        //  key, returning the end if there isn't one...
+        iterator LowerBound(const KeyType &Key) const noexcept
+        {
+            // Find the block that would hold the key. If the key is less than
+            //  every other, its lower bound is the very first...
+            BlockType * const Block = SeekBlock(Key);
+            if(Block == m_Header)
+                return begin();
+
+            // Otherwise it's within the block, or the first of the next...
+            const size_type Index = FindIndex(Block, Key);
+            return (Index < Block->GetCount())
+                ? iterator(Block, Index)
+                : iterator(Block->GetForwardPointer(0), 0);
+        }
+
+        // Visit every key value pair whose key is not less than the lower key
+        //  and less than the upper key, in order, without constructing any
+        //  iterators. The visitor is called with a pair of references to each
+        //  key and value, and if it returns a boolean, visiting stops when it
+        //  returns false. Blocks that end before the upper key are visited
+        //  without comparing each key. Return the number visited...
+        template <typename VisitorType>
+        size_type Range(
+            const KeyType &LowerKey,
+            const KeyType &UpperKey,
+            VisitorType &&Visitor) const
+        {
+            // Visit from the lower bound, a block at a time...
+            size_type Visited = 0;
+            const iterator First = LowerBound(LowerKey);
+            size_type Index = First.m_Index;
+            for(BlockType *CurrentBlock = First.m_CurrentBlock;
+                CurrentBlock;
+                CurrentBlock = CurrentBlock->GetForwardPointer(0), Index = 0)
+            {
+                // Whether the upper key could be within this block...
+                const size_type Count = CurrentBlock->GetCount();
+                const bool Bounded = !IsLessThan(CurrentBlock->GetKey(Count - 1), UpperKey);
+
+                // Visit each key in turn...
+                for(; Index < Count; ++Index)
+                {
+                    if(Bounded && !IsLessThan(CurrentBlock->GetKey(Index), UpperKey))
+                        return Visited;
+                  ++Visited;
+                    if(!SkipListVisit(Visitor, ReferenceType(CurrentBlock->GetKey(Index), CurrentBlock->GetValue(Index))))
+                        return Visited;
+                }
+            }
+
+            // Return the number visited...
+            return Visited;
+        }
+
+        // Search for the given key, returning an iterator to its key value pair
+        //  if found, or the end if not...
+        iterator Search(const KeyType &SearchKey) const noexcept
+        {
+            const iterator Iterator = LowerBound(SearchKey);
+            return (Iterator != end() && !IsLessThan(SearchKey, Iterator->first))
+                ? Iterator : end();
+        }
+
+        // Destructor...
+       ~UnrolledSkipList()
+        {
+            // Release every block after the header...
+            DestroyBlocks();
+
+            // Release the header block itself...
+            DestroySentinelBlock(m_Header);
+        }
+
+    // Protected constants...
+    protected:
+
+        // Blocks whose towers reach above this level are also kept, along with
+        //  their first keys, in a contiguous express lane ordered by key.
+        //  Searches binary search and scan its keys, vectorised where
+        //  possible, instead of chasing pointers on every level above...
+        static constexpr int ExpressLevel = std::min(4, MaximumLevels - 1);
+
+        // The express lane copies keys, so only arithmetic ones have one...
+        static constexpr bool HasExpressLane = std::is_arithmetic_v<KeyType>;
+
+    // Protected types...
+    protected:
+
+        // How sorted arrays of keys are searched...
+        using KeySearchType = SkipListKeySearch<KeyType, LessThanComparisonType>;
+
+        // How keys and values are shifted within a block...
+        using KeyValueArraysType = SkipListKeyValueArrays<KeyType, ValueType>;
+
+        // Block of keys and their values, followed immediately in memory by
+        //  its tower of forward pointers...
+        class alignas(KeyType) alignas(ValueType) alignas(void *) BlockType
+        {
+            // Public types...
+            public:
+
+                // Vector of pointers to blocks...
+                using ForwardPointersType =
+                    std::array<BlockType *, MaximumLevels>;
+
+            // Public methods...
+            public:
+
+                // Construct an empty block with a tower of the given height,
+                //  its forward pointers all null...
+                explicit BlockType(const int Height) noexcept
+                  : m_Height(Height),
+                    m_Count(0)
+                {
+                    std::uninitialized_fill_n(GetForwardPointers(), m_Height, nullptr);
+                }
+
+                // Blocks are only ever referred to by pointer...
+                BlockType(const BlockType &) = delete;
+                BlockType &operator=(const BlockType &) = delete;
+
+                // Calculate the bytes of storage needed for a block with a
+                //  tower of the given height...
+                static constexpr std::size_t GetAllocationSize(const int Height) noexcept
+                {
+                    return sizeof(BlockType) + (static_cast<std::size_t>(Height) * sizeof(BlockType *));
+                }
+
+                // Get the number of keys held...
+                size_type GetCount() const noexcept { return m_Count; }
+
+                // Get the forward pointer on the given level...
+                BlockType *GetForwardPointer(const int Level) const noexcept
+                {
+                    assert(Level < m_Height);
+                    return GetForwardPointers()[Level];
+                }
+
+                // Get the key at the given index...
+                KeyType &GetKey(const size_type Index) const noexcept
+                {
+                    assert(Index < m_Count);
+                    return GetKeys()[Index];
+                }
+
+                // Get the start of the sorted array of keys...
+                KeyType *GetKeys() const noexcept
+                {
+                    return std::launder(reinterpret_cast<KeyType *>(
+                        const_cast<std::byte *>(m_KeyStorage)));
+                }
+
+                // Get the level, or the number of levels in the list this
+                //  block participates in and hence the height of its tower...
+                int GetLevel() const noexcept { return m_Height; }
+
+                // Get the value at the given index...
+                ValueType &GetValue(const size_type Index) const noexcept
+                {
+                    assert(Index < m_Count);
+                    return GetValues()[Index];
+                }
+
+                // Erase the key and value at the given index, shifting those
+                //  after it down...
+                void EraseAt(const size_type Index) noexcept
+                {
+                    assert(Index < m_Count);
+                    KeyValueArraysType::EraseAt(GetKeys(), GetValues(), m_Count, Index);
+                  --m_Count;
+                }
+
+                // Insert the given key and value at the given index, shifting
+                //  those after it up. The block must not be full...
+                void InsertAt(const size_type Index, KeyType &&Key, ValueType &&Value) noexcept
+                {
+                    assert(Index <= m_Count && m_Count < BlockCapacity);
+                    KeyValueArraysType::InsertAt(
+                        GetKeys(), GetValues(), m_Count, Index, std::move(Key), std::move(Value));
+                  ++m_Count;
+                }
+
+                // Move the keys and values from the given index onwards to the
+                //  end of the given block, which must have room for them...
+                void MoveTail(const size_type Index, BlockType &Destination) noexcept
+                {
+                    assert(Index <= m_Count && Destination.m_Count + (m_Count - Index) <= BlockCapacity);
+                    KeyType * const Keys = GetKeys();
+                    ValueType * const Values = GetValues();
+                    for(size_type Source = Index; Source < m_Count; ++Source)
+                    {
+                        Destination.InsertAt(
+                            Destination.m_Count, std::move(Keys[Source]), std::move(Values[Source]));
+                        Keys[Source].~KeyType();
+                        Values[Source].~ValueType();
+                    }
+                    m_Count = static_cast<CountType>(Index);
+                }
+
+                // Set the forward pointer on the given level...
+                void SetForwardPointer(const int Level, BlockType * const Block) noexcept
+                {
+                    assert(Level < m_Height);
+                    GetForwardPointers()[Level] = Block;
+                }
+
+                // Destructor destroys every key and value held...
+               ~BlockType()
+                {
+                    std::destroy_n(GetKeys(), m_Count);
+                    std::destroy_n(GetValues(), m_Count);
+                }
+
+            // Protected types...
+            protected:
+
+                // Smallest unsigned integer that can count a full block...
+                using CountType = std::conditional_t<
+                    (BlockCapacity <= std::numeric_limits<std::uint16_t>::max()),
+                    std::uint16_t, std::uint32_t>;
+
+            // Protected methods...
+            protected:
+
+                // Get the start of the tower, which directly follows the
+                //  block...
+                BlockType **GetForwardPointers() const noexcept
+                {
+                    return reinterpret_cast<BlockType **>(
+                        const_cast<std::byte *>(reinterpret_cast<const std::byte *>(this)) + sizeof(BlockType));
+                }
+
+                // Get the start of the array of values...
+                ValueType *GetValues() const noexcept
+                {
+                    return std::launder(reinterpret_cast<ValueType *>(
+                        const_cast<std::byte *>(m_ValueStorage)));
+                }
+
+            // Protected attributes...
+            protected:
+
+                // Storage for the sorted keys, the first m_Count of which are
+                //  constructed. It comes first so scans read only keys...
+                alignas(KeyType) std::byte  m_KeyStorage[BlockCapacity * sizeof(KeyType)];
+
+                // Storage for their values, index for index...
+                alignas(ValueType) std::byte m_ValueStorage[BlockCapacity * sizeof(ValueType)];
+
+                // Height of the tower following the block...
+                int                         m_Height;
+
+                // Number of keys and values constructed...
+                CountType                   m_Count;
+        };
+
+    // Protected methods...
+    protected:
+
+        // Allocate and construct an empty block of the given height. If it
+        //  will be in the express lane, make room for it there now, so that
+        //  linking it in later can't fail...
+        BlockType *CreateBlock(const int Height)
+        {
+            // Make room in the express lane first...
+            if(HasExpressLane && (Height > ExpressLevel))
+            {
+                m_ExpressKeys.reserve(m_ExpressKeys.size() + 1);
+                m_ExpressBlocks.reserve(m_ExpressBlocks.size() + 1);
+            }
+
+            // Then allocate and construct the block...
+            void * const Storage = m_Allocator.Allocate(
+                BlockType::GetAllocationSize(Height), alignof(BlockType), Height);
+            return new(Storage) BlockType(Height);
+        }
+
+        // Allocate and construct a header block of the given height. It comes
+        //  from the free store rather than the block allocator so it survives
+        //  the allocator releasing all blocks...
+        static BlockType *CreateSentinelBlock(const int Height)
+        {
+            void * const Storage = ::operator new(
+                BlockType::GetAllocationSize(Height), std::align_val_t(alignof(BlockType)));
+            return new(Storage) BlockType(Height);
+        }
+
+        // Destroy and de-allocate the given block...
+        void DestroyBlock(BlockType * const Block) noexcept
+        {
+            // Remember the block's height before it is destroyed...
+            const int Height = Block->GetLevel();
+
+            // Destroy the block's keys and values...
+            Block->~BlockType();
+
+            // Release its storage...
+            m_Allocator.Deallocate(
+                Block, BlockType::GetAllocationSize(Height), Height);
+        }
+
+        // Destroy every block after the header, leaving the header's forward
+        //  pointers dangling for the caller to repair...
+        void DestroyBlocks() noexcept
+        {
+            // If there is nothing to destroy in each block and the allocator
+            //  can release all of its blocks at once, let it do so without
+            //  walking the list...
+            if constexpr(std::is_trivially_destructible_v<KeyType> &&
+                         std::is_trivially_destructible_v<ValueType> &&
+                         AllocatorType::CanDeallocateAll)
+                m_Allocator.DeallocateAll();
+
+            // Otherwise walk the bottom level destroying each block...
+            else
+            {
+                BlockType *CurrentBlock = m_Header->GetForwardPointer(0);
+                while(CurrentBlock)
+                {
+                    BlockType * const NextBlock = CurrentBlock->GetForwardPointer(0);
+                    DestroyBlock(CurrentBlock);
+                    CurrentBlock = NextBlock;
+                }
+            }
+        }
+
+        // Destroy and de-allocate the given header block...
+        static void DestroySentinelBlock(BlockType * const Block) noexcept
+        {
+            Block->~BlockType();
+            ::operator delete(Block, std::align_val_t(alignof(BlockType)));
+        }
+
+        // Find the index of the first key in the given block not less than
+        //  the given key, which is the block's count if there are none...
+        size_type FindIndex(const BlockType * const Block, const KeyType &Key) const noexcept
+        {
+            return KeySearchType::template CountBefore<false>(
+                Block->GetKeys(), Block->GetCount(), Key, m_LessThanComparison);
+        }
+
+        // Select the random level of a new block...
+        int GetRandomLevel() noexcept
+        {
+            return m_LevelGenerator.GetLevel(MaximumLevels);
+        }
+
+        // Compare two keys for logical less than using the user's comparison
+        //  object...
+        bool IsLessThan(const KeyType &LeftHandSide, const KeyType &RightHandSide) const
+        {
+            return m_LessThanComparison(LeftHandSide, RightHandSide);
+        }
+
+        // Link the given new block, which must hold at least one key, in after
+        //  the given blocks on each level it participates in. They must all be
+        //  to its left and populated up to the smaller of its level and the
+        //  list's highest...
+        void LinkBlock(
+            typename BlockType::ForwardPointersType &UpdatedPointers,
+            BlockType * const NewBlock) noexcept
+        {
+            // The new level is higher than the current highest level in the
+            //  list, so the header is on its left on each level above...
+            const int NewLevel = NewBlock->GetLevel() - 1;
+            for(; m_HighestLevel < NewLevel; ++m_HighestLevel)
+                UpdatedPointers[m_HighestLevel + 1] = m_Header;
+
+            // Splice pointers on every level the new block is linked into...
+            for(int CurrentLevel = 0; CurrentLevel <= NewLevel; ++CurrentLevel)
+            {
+                NewBlock->SetForwardPointer(
+                    CurrentLevel, UpdatedPointers[CurrentLevel]->GetForwardPointer(CurrentLevel));
+                UpdatedPointers[CurrentLevel]->SetForwardPointer(CurrentLevel, NewBlock);
+            }
+
+            // If it's tall enough, add it to the express lane in order of its
+            //  first key. CreateBlock() already made room...
+            if constexpr(HasExpressLane)
+            {
+                if(NewBlock->GetLevel() > ExpressLevel)
+                {
+                    const std::size_t Position = KeySearchType::template CountBefore<false>(
+                        m_ExpressKeys.data(), m_ExpressKeys.size(), NewBlock->GetKey(0), m_LessThanComparison);
+                    m_ExpressKeys.insert(m_ExpressKeys.begin() + Position, NewBlock->GetKey(0));
+                    m_ExpressBlocks.insert(m_ExpressBlocks.begin() + Position, NewBlock);
+                }
+            }
+        }
+
+        // Find the rightmost block whose first key is not greater than the
+        //  given key, or less than it if not Inclusive, which is the header if
+        //  there are none. If UpdatedPointers is provided, it receives the
+        //  rightmost such block on every level from the highest down.
+        //  Otherwise the express lane, if there is one, stands in for every
+        //  level from its own up...
+        template <bool Inclusive = true>
+        BlockType *SeekBlock(
+            const KeyType &Key,
+            typename BlockType::ForwardPointersType * const UpdatedPointers = nullptr) const
+        {
+            // Start with the header block, from the highest level...
+            BlockType *CurrentBlock = m_Header;
+            int CurrentLevel = m_HighestLevel;
+
+            // Or search the express lane's keys instead of chasing the
+            //  pointers on the levels it covers, and start from the rightmost
+            //  block found there, one level below...
+            if constexpr(HasExpressLane)
+            {
+                if(!UpdatedPointers && (m_HighestLevel >= ExpressLevel))
+                {
+                    const std::size_t Before = KeySearchType::template CountBefore<Inclusive>(
+                        m_ExpressKeys.data(), m_ExpressKeys.size(), Key, m_LessThanComparison);
+                    if(Before > 0)
+                        CurrentBlock = m_ExpressBlocks[Before - 1];
+                    CurrentLevel = ExpressLevel - 1;
+                }
+            }
+
+            // Examine each remaining level, down to the lowest...
+            for(; CurrentLevel >= 0; --CurrentLevel)
+            {
+                // Keep moving right on this level as far as we can without
+                //  overshooting...
+                for(BlockType *NextBlock = CurrentBlock->GetForwardPointer(CurrentLevel);
+                    NextBlock && (Inclusive
+                        ? !IsLessThan(Key, NextBlock->GetKey(0))
+                        : IsLessThan(NextBlock->GetKey(0), Key));
+                    NextBlock = CurrentBlock->GetForwardPointer(CurrentLevel))
+                    CurrentBlock = NextBlock;
+
+                // Save the block on the left on this level, if requested...
+                if(UpdatedPointers)
+                    (*UpdatedPointers)[CurrentLevel] = CurrentBlock;
+            }
+
+            // Return the rightmost block found...
+            return CurrentBlock;
+        }
+
+        // Unlink the given block, which must still hold its keys, from every
+        //  level it participates in, given the blocks on its left on each of
+        //  them, and from the express lane if it's there...
+        void UnlinkBlock(
+            const typename BlockType::ForwardPointersType &UpdatedPointers,
+            BlockType * const Block) noexcept
+        {
+            // Remove it from the express lane...
+            if constexpr(HasExpressLane)
+            {
+                if(Block->GetLevel() > ExpressLevel)
+                {
+                    const std::size_t Position = KeySearchType::template CountBefore<false>(
+                        m_ExpressKeys.data(), m_ExpressKeys.size(), Block->GetKey(0), m_LessThanComparison);
+                    assert(m_ExpressBlocks[Position] == Block);
+                    m_ExpressKeys.erase(m_ExpressKeys.begin() + Position);
+                    m_ExpressBlocks.erase(m_ExpressBlocks.begin() + Position);
+                }
+            }
+
+            // Unlink it from each level...
+            for(int CurrentLevel = 0; CurrentLevel < Block->GetLevel(); ++CurrentLevel)
+            {
+                assert(UpdatedPointers[CurrentLevel]->GetForwardPointer(CurrentLevel) == Block);
+                UpdatedPointers[CurrentLevel]->SetForwardPointer(
+                    CurrentLevel, Block->GetForwardPointer(CurrentLevel));
+            }
+        }
+
+        // The given block's first key has changed from the given one, so if
+        //  it's in the express lane, update its key there...
+        void UpdateExpressKey(
+            [[maybe_unused]] const BlockType * const Block,
+            [[maybe_unused]] const KeyType &PreviousKey) noexcept
+        {
+            if constexpr(HasExpressLane)
+            {
+                if(Block->GetLevel() > ExpressLevel)
+                {
+                    const std::size_t Position = KeySearchType::template CountBefore<false>(
+                        m_ExpressKeys.data(), m_ExpressKeys.size(), PreviousKey, m_LessThanComparison);
+                    assert(m_ExpressBlocks[Position] == Block);
+                    m_ExpressKeys[Position] = Block->GetKey(0);
+                }
+            }
+        }
+
+    // Protected attributes...
+    protected:
+
+        // Header block, which never holds any keys...
+        BlockType                  *m_Header;
+
+        // Highest level currently in use by any block...
+        int                         m_HighestLevel;
+
+        // Comparison object...
+        LessThanComparisonType      m_LessThanComparison;
+
+        // Level generator...
+        LevelGeneratorType          m_LevelGenerator;
+
+        // First keys of the blocks in the express lane, in order...
+        std::vector<KeyType>        m_ExpressKeys;
+
+        // The blocks in the express lane, index for index...
+        std::vector<BlockType *>    m_ExpressBlocks;
+
+        // Number of keys held...
+        size_type                   m_Size;
+
+        // Block allocator...
+        AllocatorType               m_Allocator;
+};
+
+#endif
+